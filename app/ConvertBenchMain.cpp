@@ -0,0 +1,126 @@
+#include <CFBoard.h>
+#include <PositionsCorpus.h>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utils.h>
+#include <vector>
+
+// Usage: convert_bench [rounds] [corpus file (.txt)]
+//
+// Converts every position of the corpus (all five corpora by default) to a
+// Stockfish::Position rounds times, for both players, and prints the time per
+// conversion: the FEN alone, then the whole conversion with a new state list
+// every time (what a search costs, since Stockfish takes the list) and with
+// one list reused. Before timing, checks that Stockfish reads back the pieces
+// of every position.
+
+namespace {
+
+// The FEN of CFBoard::toFEN and a new state list, as before stockfishFEN
+void convertThroughToFEN(CFBoard &board, Stockfish::Position &pos,
+												 Stockfish::StateListPtr &states) {
+	states = Stockfish::StateListPtr(new std::deque<Stockfish::StateInfo>(1));
+	pos.set(board.toFEN(), false, &states->back(), Stockfish::Threads.main());
+}
+
+template <typename Convert>
+double nanosecondsPerPosition(std::vector<CFBoard> &boards, int rounds,
+															Convert convert) {
+	auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round < rounds; round++) {
+		for (CFBoard &board : boards) {
+			convert(board);
+		}
+	}
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	return std::chrono::duration<double, std::nano>(elapsed).count() /
+				 (boards.size() * rounds);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+	int rounds = 20;
+	std::vector<std::string> corpora;
+	for (int i = 1; i < argc; i++) {
+		if (i == 1 && isdigit(argv[i][0])) {
+			rounds = std::max(1, atoi(argv[i]));
+		} else {
+			corpora.push_back(argv[i]);
+		}
+	}
+	if (corpora.empty()) {
+		for (const std::string &fileName : PositionsCorpus::fileNames) {
+			corpora.push_back(std::string(CMAKE_SOURCE_DIR) + "/Positions/" + fileName);
+		}
+	}
+
+	std::vector<CFBoard> boards;
+	for (const std::string &corpus : corpora) {
+		std::vector<std::string> FENs = PositionsCorpus::loadFENs(corpus);
+		if (FENs.empty()) {
+			std::cerr << "cannot read positions from " << corpus << std::endl;
+			return 1;
+		}
+		for (const std::string &FEN : FENs) {
+			boards.emplace_back(FEN);
+			boards.emplace_back(FEN);
+			boards.back().forceFlipTurn();
+		}
+	}
+	std::cout << boards.size() << " positions, " << rounds << " rounds\n\n";
+
+	// Position::set needs the tables and a thread; the threads need the options
+	Stockfish::UCI::init(Stockfish::Options);
+	Stockfish::PSQT::init();
+	Stockfish::Bitboards::init();
+	Stockfish::Position::init();
+	Stockfish::Threads.set(1);
+
+	Stockfish::Position pos;
+	Stockfish::StateListPtr states;
+	for (CFBoard &board : boards) {
+		convert_CFBoard_to_Stockfish_Position(board, pos, states);
+		// Only the pieces and the player: Stockfish drops the castling rights and
+		// en passant tiles it cannot use
+		std::string expected = board.toFEN(), read = pos.fen();
+		if (read.substr(0, read.find(' ', read.find(' ') + 1)) !=
+				expected.substr(0, expected.find(' ', expected.find(' ') + 1))) {
+			std::cerr << "Stockfish reads " << read << " instead of " << expected
+								<< std::endl;
+			return 1;
+		}
+	}
+
+	size_t checksum = 0; // keeps the conversions from being optimized away
+	double FENTime = nanosecondsPerPosition(boards, rounds, [&](CFBoard &board) {
+		checksum += stockfishFEN(board).size();
+	});
+	double toFENTime = nanosecondsPerPosition(boards, rounds, [&](CFBoard &board) {
+		checksum += board.toFEN().size();
+	});
+	double oldTime = nanosecondsPerPosition(boards, rounds, [&](CFBoard &board) {
+		convertThroughToFEN(board, pos, states);
+		checksum += pos.key();
+	});
+	double newListTime = nanosecondsPerPosition(boards, rounds, [&](CFBoard &board) {
+		states.reset();
+		convert_CFBoard_to_Stockfish_Position(board, pos, states);
+		checksum += pos.key();
+	});
+	double reusedListTime = nanosecondsPerPosition(boards, rounds, [&](CFBoard &board) {
+		convert_CFBoard_to_Stockfish_Position(board, pos, states);
+		checksum += pos.key();
+	});
+
+	std::cout << "CFBoard::toFEN:              " << toFENTime << " ns\n";
+	std::cout << "stockfishFEN:                " << FENTime << " ns\n";
+	std::cout << "conversion through toFEN:    " << oldTime << " ns\n";
+	std::cout << "conversion, new state list:  " << newListTime << " ns\n";
+	std::cout << "conversion, same state list: " << reusedListTime << " ns\n";
+	std::cout << "(checksum " << checksum << ")" << std::endl;
+	return 0;
+}
@@ -0,0 +1,82 @@
+#include <CFBoard.h>
+#include <DFS1P.h>
+#include <PositionsCorpus.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Usage: dfs1p_bench [depth] [-t max threads] [corpus file (.txt)]
+//
+// Searches every position of the corpus (completely closed positions by
+// default) with 1, 2, 4, ... up to max threads, and prints the time, the
+// speedup over one thread and whether the chosen moves are the same.
+
+int main(int argc, char **argv) {
+	int depth = 3;
+	int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	std::string corpus = std::string(CMAKE_SOURCE_DIR) +
+											 "/Positions/completely_closed_positions.txt";
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+			maxThreads = std::max(1, atoi(argv[++i]));
+		} else if (i == 1 && isdigit(argv[i][0])) {
+			depth = atoi(argv[i]);
+		} else {
+			corpus = argv[i];
+		}
+	}
+
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(corpus);
+	if (FENs.empty()) {
+		std::cerr << "cannot read positions from " << corpus << std::endl;
+		return 1;
+	}
+	std::cout << FENs.size() << " positions, depth " << depth << "\n\n";
+
+	Closedfish::SearchLimits limits;
+	limits.maxDepth = depth;
+	std::vector<Closedfish::Move> reference;
+	double referenceSeconds = 0;
+	for (int threads = 1; threads <= maxThreads; threads *= 2) {
+		std::vector<Closedfish::Move> moves;
+		uint64_t nodes = 0;
+		double seconds = 0;
+		for (const std::string &FEN : FENs) {
+			// Fresh engine, so that no position is found in the transposition
+			// table of an earlier one
+			DFS1P engine;
+			engine.setThreads(threads);
+			engine.setSearchLimits(limits);
+			CFBoard board(FEN);
+			engine.setBoardPointer(&board);
+
+			auto start = std::chrono::steady_clock::now();
+			moves.push_back(engine.getNextMove());
+			seconds += std::chrono::duration<double>(
+										 std::chrono::steady_clock::now() - start)
+										 .count();
+			nodes += engine.getSearchedNodes();
+		}
+		if (threads == 1) {
+			reference = moves;
+			referenceSeconds = seconds;
+		}
+		int different = 0;
+		for (std::size_t i = 0; i < moves.size(); i++) {
+			different += std::get<0>(moves[i]) != std::get<0>(reference[i]) ||
+									 std::get<1>(moves[i]) != std::get<1>(reference[i]);
+		}
+		std::cout << "Threads: " << threads << "\tTime: " << seconds
+							<< " s\tNodes: " << nodes
+							<< "\tSpeedup: " << (seconds > 0 ? referenceSeconds / seconds : 0)
+							<< "\tDifferent moves: " << different << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,77 @@
+#include <CFBoard.h>
+#include <Heatmap.h>
+#include <PositionsCorpus.h>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Usage: heatmap_bench [rounds] [corpus file (.txt)]
+//
+// Builds the heatmap of every position of the corpus (all five corpora by
+// default) rounds times, for both players, and prints the heatmaps built per
+// second by buildHeatMap and addHeatMap. Every file counts as a weak pawn
+// file, which gives the most work to the positions without open files.
+
+int main(int argc, char **argv) {
+	int rounds = 20;
+	std::vector<std::string> corpora;
+	for (int i = 1; i < argc; i++) {
+		if (i == 1 && isdigit(argv[i][0])) {
+			rounds = std::max(1, atoi(argv[i]));
+		} else {
+			corpora.push_back(argv[i]);
+		}
+	}
+	if (corpora.empty()) {
+		for (const std::string &fileName : PositionsCorpus::fileNames) {
+			corpora.push_back(std::string(CMAKE_SOURCE_DIR) + "/Positions/" + fileName);
+		}
+	}
+
+	std::vector<CFBoard> boards;
+	for (const std::string &corpus : corpora) {
+		std::vector<std::string> FENs = PositionsCorpus::loadFENs(corpus);
+		if (FENs.empty()) {
+			std::cerr << "cannot read positions from " << corpus << std::endl;
+			return 1;
+		}
+		for (const std::string &FEN : FENs) {
+			boards.emplace_back(FEN);
+			boards.emplace_back(FEN);
+			boards.back().forceFlipTurn();
+		}
+	}
+	std::cout << boards.size() << " positions, " << rounds << " rounds\n\n";
+
+	const uint64_t weakPawns = 0xFF;
+	long long checksum = 0; // keeps the heatmaps from being optimized away
+
+	auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round < rounds; round++) {
+		for (CFBoard &board : boards) {
+			int16_t heatMap[6][64];
+			Heatmap::buildHeatMap(board, heatMap, weakPawns);
+			checksum += heatMap[round % 6][round % 64];
+		}
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "buildHeatMap: " << static_cast<double>(boards.size()) * rounds / seconds << " heatmaps/s" << std::endl;
+
+	start = std::chrono::steady_clock::now();
+	for (int round = 0; round < rounds; round++) {
+		for (CFBoard &board : boards) {
+			int heatMap[6][8][8];
+			memset(heatMap, 0, sizeof heatMap);
+			Heatmap::addHeatMap(board, heatMap, weakPawns);
+			checksum += heatMap[round % 6][round % 8][round % 8];
+		}
+	}
+	seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "addHeatMap:   " << static_cast<double>(boards.size()) * rounds / seconds << " heatmaps/s" << std::endl;
+	std::cout << "(checksum " << checksum << ")" << std::endl;
+	return 0;
+}
@@ -0,0 +1,64 @@
+#include <AttackTables.h>
+#include <CFBoard.h>
+#include <Perft.h>
+#include <PositionsCorpus.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Usage: perft [depth] [-t threads] [--legacy] [--classic-checks]
+//              [FEN | corpus file (.txt)]
+//
+// With a FEN (the starting position by default), prints the node count of
+// every root move followed by the total and the speed. With one of the
+// corpora of Positions/, only prints the totals over every position.
+
+int main(int argc, char **argv) {
+	int depth = 5;
+	int threads = std::max(1u, std::thread::hardware_concurrency());
+	Perft::MoveSource source = Perft::MoveSource::GENERATE_MOVES;
+	std::string position;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "--legacy")) {
+			source = Perft::MoveSource::GET_LEGAL_MOVES;
+		} else if (!strcmp(argv[i], "--classic-checks")) {
+			AttackTables::setCheckMode(AttackTables::CheckMode::CLASSIC);
+		} else if (position.empty() && i == 1 && isdigit(argv[i][0])) {
+			depth = atoi(argv[i]);
+		} else {
+			position += position.empty() ? argv[i] : std::string(" ") + argv[i];
+		}
+	}
+
+	if (position.size() > 4 &&
+			position.compare(position.size() - 4, 4, ".txt") == 0) {
+		std::vector<std::string> FENs = PositionsCorpus::loadFENs(position);
+		if (FENs.empty()) {
+			std::cerr << "cannot read positions from " << position << std::endl;
+			return 1;
+		}
+		Perft::Result total;
+		for (const std::string &FEN : FENs) {
+			Perft::Result result = Perft::run(CFBoard(FEN), depth, threads, source);
+			total.nodes += result.nodes;
+			total.seconds += result.seconds;
+		}
+		std::cout << "Positions: " << FENs.size() << '\n';
+		Perft::printDivide(total, std::cout);
+		return 0;
+	}
+
+	CFBoard board = position.empty() ? CFBoard() : CFBoard(position);
+	std::cout << board.toFEN() << ", depth " << depth << ", " << threads
+						<< " thread(s)\n\n";
+	Perft::printDivide(Perft::run(board, depth, threads, source), std::cout);
+	return 0;
+}
@@ -1,19 +1,5 @@
 #include "SwitchMain.h"
 
-// https://stackoverflow.com/questions/11826554/standard-no-op-output-stream/11826666#11826666
-class NullBuffer : public std::streambuf {
-public:
-	int overflow(int c) { return c; }
-};
-NullBuffer null_buffer;
-std::ostream null_stream(&null_buffer);
-
-#ifdef DEBUG
-#define debug std::cerr
-#else
-#define debug null_stream
-#endif
-
 Closedfish::Move InputFromUI() { return {0, 0, 0.0}; }
 
 void chessGameLoop(SwitchEngine &engine) {
@@ -30,16 +16,20 @@ void chessGameLoop(SwitchEngine &engine) {
 
 void CLIGameLoop(SwitchEngine &engine) {
 	while (true) {
-		debug << "[DEBUG] CLIGameLoop" << std::endl;
+		CF_LOG_DEBUG("CLIGameLoop");
 		try {
 			Closedfish::Move nm = engine.getNextMove();
-			debug << toAN(std::get<0>(nm)) << toAN(std::get<1>(nm)) << std::endl;
+			CF_LOG_DEBUG(toAN(std::get<0>(nm)), toAN(std::get<1>(nm)));
 			engine.processMove(nm);
 		} catch (std::string st) {
-			debug << "[ERROR] " << st << std::endl;
+			CF_LOG_ERROR(st);
+			exit(1);
+		} catch (const char *error) {
+			// What the engines throw, e.g. "Stockfish invalid output"
+			CF_LOG_ERROR(error);
 			exit(1);
 		}
-		debug << "[INFO] Waiting for opponent\'s move" << std::endl;
+		CF_LOG_INFO("Waiting for opponent\'s move");
 		std::string opponentMove;
 		std::cin >> opponentMove;
 		// quick sanity check
@@ -51,12 +41,11 @@ void CLIGameLoop(SwitchEngine &engine) {
 			Closedfish::Move opp =
 					std::make_tuple(parseAN(opponentMove.substr(0, 2)),
 													parseAN(opponentMove.substr(2, 2)), 0.0);
-			debug << "[DEBUG] " << std::get<0>(opp) << " " << std::get<1>(opp)
-						<< std::endl;
+			CF_LOG_DEBUG(std::get<0>(opp), " ", std::get<1>(opp));
 			engine.processMove(opp);
 		} else {
-			debug << "[DEBUG] Invalid move string!, got [" << opponentMove
-						<< "]: " << opponentMove.size() << std::endl;
+			CF_LOG_DEBUG("Invalid move string!, got [", opponentMove, "]: ",
+									 opponentMove.size());
 			throw "Invalid move string!";
 		}
 	}
@@ -67,8 +56,13 @@ typedef void (*OnChange)(const Stockfish::UCI::Option &);
 void opt(const Stockfish::UCI::Option &o) { Stockfish::Eval::NNUE::init(); };
 
 int main(int argc, char *argv[]) {
-	Closedfish::Logger logger;
-	debug << "[INFO] " << Stockfish::engine_info() << std::endl;
+	// To stderr, from the background thread of the log
+	Closedfish::Log::start(MODE_CLI ? Closedfish::Log::Level::Debug
+																	: Closedfish::Log::Level::Warning);
+	// Stockfish's text output is only kept for debugging
+	Closedfish::Logger logger(MODE_CLI ? Closedfish::LogOutput::RING
+																		 : Closedfish::LogOutput::NONE);
+	CF_LOG_INFO(Stockfish::engine_info());
 	Stockfish::CommandLine::init(argc, argv);
 	Stockfish::UCI::init(Stockfish::Options);
 	std::filesystem::path p = std::filesystem::path(CMAKE_SOURCE_DIR) /
@@ -76,11 +70,10 @@ int main(int argc, char *argv[]) {
 														(std::string)Stockfish::Options["EvalFile"];
 	std::ifstream stream(p.string(), std::ios::binary);
 	if (stream.fail()) {
-		debug << "[ERROR] EvalFile doesn't exist. Expected directory: "
-					<< p.string() << std::endl;
+		CF_LOG_ERROR("EvalFile doesn't exist. Expected directory: ", p.string());
 		exit(-1);
 	} else {
-		debug << "[INFO] EvalFile found." << std::endl;
+		CF_LOG_INFO("EvalFile found.");
 	}
 	stream.close();
 	Stockfish::Options["EvalFile"]
@@ -99,7 +92,7 @@ int main(int argc, char *argv[]) {
 	// DFS1P a;
 	// a.testDFS();
 
-	debug << "[INFO] a.testDFS() done" << std::endl;
+	CF_LOG_INFO("a.testDFS() done");
 	return 0;
 
 	CFBoard board;
@@ -107,7 +100,7 @@ int main(int argc, char *argv[]) {
 
 	srand(time(NULL));
 
-	debug << "[INFO] Setup done" << std::endl;
+	CF_LOG_INFO("Setup done");
 
 	if (MODE_CLI)
 		CLIGameLoop(engine);
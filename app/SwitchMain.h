@@ -8,6 +8,7 @@
 
 #include <CFBoard.h>
 #include <DFS1P.h>
+#include <Log.h>
 #include <SwitchEngine.h>
 #include <utils.h>
 
@@ -4,16 +4,20 @@ using std::cerr;
 bool DFS1P::squareSafeFromOpponentPawns(const bool &currentTurn, const uint64_t& opponentPawnBoard, const int& row, const int &col) {
 	// Black's turn
 	if (currentTurn)
-		return row == 7 || ((col == 0 || !isBitSet(opponentPawnBoard, Heatmap::posToTile({row+1, col-1})))
-				&& (col == 7 || !isBitSet(opponentPawnBoard, Heatmap::posToTile({row+1, col+1}))));
+		return row == 7 || ((col == 0 || !isBitSet(opponentPawnBoard, Heatmap::posToTile(row+1, col-1)))
+				&& (col == 7 || !isBitSet(opponentPawnBoard, Heatmap::posToTile(row+1, col+1))));
 	// White's turn
 	else
-		return row == 0 || ((col == 0 || !isBitSet(opponentPawnBoard, Heatmap::posToTile({row-1, col-1})))
-				&& (col == 7 || !isBitSet(opponentPawnBoard, Heatmap::posToTile({row-1, col+1}))));
+		return row == 0 || ((col == 0 || !isBitSet(opponentPawnBoard, Heatmap::posToTile(row-1, col-1)))
+				&& (col == 7 || !isBitSet(opponentPawnBoard, Heatmap::posToTile(row-1, col+1))));
 }
 
 //Distance between two squares with respect to a piece's movement using BFS
 std::array<int, 64> DFS1P::distFromTileToTilesAsPiece(CFBoard& board, int halfPieceId, int startTile) {
+	if (distanceMode == DistanceMode::FLOOD_FILL) {
+		return PieceDistances::fromTile(board, halfPieceId, startTile);
+	}
+
 	std::queue<int> q;
 	std::array<int, 64> dist;
 	bool currentTurn = board.getCurrentPlayer(); // 0: white, 1: black
@@ -32,7 +36,7 @@ std::array<int, 64> DFS1P::distFromTileToTilesAsPiece(CFBoard& board, int halfPi
 
 		// All next tiles possible
 		uint64_t nextSquares = board.getLegalMoves(2*halfPieceId + currentTurn, curTile);
-		for (int newTile: bitSetPositions(nextSquares)) {
+		for (int newTile: setBits(nextSquares)) {
 			// Already visited
 			if (dist[newTile] != -1) continue;
 			// Square not empty
@@ -53,18 +57,27 @@ int DFS1P::distFromHeatmap(CFBoard& board, int (&heatMap)[6][8][8]) {
 	int dist = 0;
 
 	// Coefficient representing the value added to the distance when the desirable square is unreachable from current square
-	const int COEFF_SEPARATED = 10; // adjustable
+	const int COEFF_SEPARATED = HeatmapEvaluator::COEFF_SEPARATED;
 
 	bool currentTurn = board.getCurrentPlayer(); // 0: white, 1: black
+	// Shared by the flood fills of all the pieces
+	PieceDistances::BoardInfo info;
+	if (distanceMode == DistanceMode::FLOOD_FILL) {
+		info = PieceDistances::describe(board);
+	}
 
 	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		// No hot square for this piece type: no need for its distances
+		if (std::all_of(&heatMap[halfPieceId][0][0], &heatMap[halfPieceId][0][0] + 64, [](int heat) { return heat == 0; })) continue;
+
 		// Get current piece positions
 		uint64_t pieceBoard = board.getPieceColorBitBoard(2*halfPieceId|currentTurn);
-		std::vector<int> pieceTiles = bitSetPositions(pieceBoard);
 
-		for (int startTile: pieceTiles) {
+		for (int startTile: setBits(pieceBoard)) {
 			// Find distances of all square from current square, with respect to the piece
-			std::array<int, 64> distFromStart = distFromTileToTilesAsPiece(board, halfPieceId, startTile);
+			std::array<int, 64> distFromStart = distanceMode == DistanceMode::FLOOD_FILL
+				? PieceDistances::fromTile(board, info, halfPieceId, startTile)
+				: distFromTileToTilesAsPiece(board, halfPieceId, startTile);
 			
 			for (int i = 0; i < 8; i++) {
 				for (int j = 0; j < 8; j++) {
@@ -86,60 +99,235 @@ int DFS1P::distFromHeatmap(CFBoard& board, int (&heatMap)[6][8][8]) {
 	return dist;
 }
 
-void DFS1P::DFS1pAux(CFBoard* currentBoard, int depth, int maxDepth, std::vector<Closedfish::Move> curLine, std::vector<std::vector<Closedfish::Move>>& possibleLines) {
-	// Return if max depth is reached
+uint64_t DFS1P::heatmapSignature(int (&heatMap)[6][8][8]) {
+	// FNV-1a over the heat values
+	uint64_t signature = 0xCBF29CE484222325ull;
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		for (int i = 0; i < 8; i++) {
+			for (int j = 0; j < 8; j++) {
+				signature = (signature ^ static_cast<uint32_t>(heatMap[halfPieceId][i][j])) * 0x100000001B3ull;
+			}
+		}
+	}
+	return signature;
+}
+
+void DFS1P::setDistanceMode(DistanceMode mode) {
+	distanceMode = mode;
+}
+
+void DFS1P::setEvaluationMode(EvaluationMode mode) {
+	evaluationMode = mode;
+}
+
+void DFS1P::setThreads(int threadCount) {
+	threads = std::max(1, threadCount);
+}
+
+void DFS1P::setHashSize(std::size_t sizeMB) {
+	useTranspositionTable = sizeMB > 0;
+	if (useTranspositionTable) {
+		transpositionTable.resize(sizeMB);
+	}
+}
+
+void DFS1P::generateSearchedMoves(CFBoard* board, int depth, const std::vector<Closedfish::Move>& curLine, MoveList& moveList) {
+	bool currentTurn = board->getCurrentPlayer(); // 0: white, 1: black
+	uint64_t allBoard = board->getColorBitBoard(0) | board->getColorBitBoard(1);
+	uint64_t opponentPawnBoard = board->getPieceColorBitBoard(!currentTurn);
+
+	MoveList legalMoves;
+	board->generateMoves(legalMoves);
+
+	moveList.clear();
+	for (uint16_t move: legalMoves) {
+		int endTile = CFMove::endTile(move);
+		// Avoid capturing (en passant included)
+		if (((allBoard >> endTile) & 1) || CFMove::type(move) == CFMove::EN_PASSANT) continue;
+		// Only promote to a queen, like movePiece does by default
+		if (CFMove::type(move) == CFMove::PROMOTION && CFMove::promotionType(move) != 4) continue;
+		// Avoid unsafe moves
+		if (!squareSafeFromOpponentPawns(currentTurn, opponentPawnBoard, endTile/8, endTile%8)) continue;
+		moveList.push(move);
+	}
+
+	// Search the best line of the previous depth first
+	if (depth < static_cast<int>(previousLine.size()) && std::equal(curLine.begin(), curLine.end(), previousLine.begin())) {
+		int start = std::get<0>(previousLine[depth]), end = std::get<1>(previousLine[depth]);
+		uint16_t *first = std::find_if(moveList.moves, moveList.moves + moveList.size(), [&](uint16_t move) {
+			return CFMove::startTile(move) == start && CFMove::endTile(move) == end;
+		});
+		if (first != moveList.moves + moveList.size()) {
+			std::rotate(moveList.moves, first, first + 1);
+		}
+	}
+}
+
+int DFS1P::DFS1pAux(CFBoard* board, int depth, int maxDepth, int (&heatMap)[6][8][8], std::vector<Closedfish::Move>& curLine, std::vector<Closedfish::Move>& bestLine, int& bestDist, HeatmapEvaluator* evaluator) {
+	// Give up the current depth once the budget is spent or the search is
+	// stopped from outside (the first depth too: its move is not wanted then)
+	uint64_t nodes = searchedNodes.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (searchAborted || (stopFlag && stopFlag->load(std::memory_order_relaxed)) ||
+			(checkLimits && searchLimitReached(nodes))) {
+		searchAborted = true;
+		return TranspositionTable::noScore;
+	}
+
+	uint64_t key = board->getHash() ^ heatmapKey;
+	TranspositionTable::Entry entry;
+	bool found = useTranspositionTable && transpositionTable.probe(key, maxDepth - depth, entry);
+
+	// Evaluate once max depth is reached
 	if (depth == maxDepth) {
-		// Adding current line to possible lines
-		possibleLines.push_back(curLine);
-		return;
+		int dist;
+		// Leaf evaluations are cached across searches
+		if (found) {
+			dist = entry.score;
+		} else {
+			dist = evaluator ? evaluator->getDistance() : distFromHeatmap(*board, heatMap);
+			if (useTranspositionTable) {
+				transpositionTable.store(key, 0, dist, 0);
+			}
+		}
+		// Check if the moves make us closer to the heatMap
+		if (dist < bestDist) {
+			bestDist = dist;
+			// If yes then update the most potential line
+			bestLine = curLine;
+		}
+		return dist;
 	}
 
-	bool currentTurn = currentBoard->getCurrentPlayer(); // 0: white, 1: black
-
-	for (int startTile = 0; startTile < 64; startTile++) {
-		// Get piece at startTile, skip if it's empty or it contains opponent piece
-		int pieceId = currentBoard->getPieceFromCoords(startTile);
-		// if (startTile == 38) {
-		// 		cerr << currentBoard->getRepr();
-		// 		cerr << pieceId << ' ' << currentBoard->getCurrentPlayer() << '\n';
-		// 	}
-		if (pieceId == -1 || (pieceId%2 != currentTurn)) continue;
-
-		// Get all legal moves, represent it as a vector of possible end tiles
-		uint64_t legalMoves =  currentBoard->getLegalMoves(pieceId, startTile);
-		std::vector<int> endTiles = bitSetPositions(legalMoves);
-
-		for (int endTile: endTiles) {
-			// if (startTile == 38 && endTile == 30) {
-			// 	cerr << currentBoard->getRepr();
-			// 	cerr << pieceId << ' ' << currentBoard->getCurrentPlayer() << '\n';
-			// 	exit(-1);
-			// }
-			// Avoid capturing
-			if (currentBoard->getPieceFromCoords(endTile) != -1) continue;
-			// Avoid unsafe moves
-			if (!squareSafeFromOpponentPawns(currentTurn,
-			currentBoard->getPieceColorBitBoard(!currentTurn), endTile/8, endTile%8)) continue;
-			
-			// Add the move to the current line
-			curLine.push_back(std::make_tuple(startTile, endTile, 0.0));
+	// The same position can be reached with the moves in another order. Its
+	// lines cannot beat the best line (of this thread, or of the finished root
+	// moves of the other threads) if their score is not lower, which is always
+	// the case when it was already searched at this depth.
+	if (depth > 0 && found && entry.score >= std::min(bestDist, sharedCutoff.load(std::memory_order_relaxed))) {
+		return entry.score;
+	}
 
-			// Simulate the move
-			currentBoard->movePiece(startTile, endTile);
-			currentBoard->forceFlipTurn(); // skipping opponent's turn
-			DFS1pAux(currentBoard, depth+1, maxDepth, curLine, possibleLines);
-			
-			// Unsimulate the move
+	MoveList moveList;
+	generateSearchedMoves(board, depth, curLine, moveList);
+
+	int score = TranspositionTable::noScore;
+	uint16_t bestMove = 0;
+	for (uint16_t move: moveList) {
+		// Add the move to the current line
+		curLine.push_back(std::make_tuple(CFMove::startTile(move), CFMove::endTile(move), 0.0));
+
+		// Simulate the move
+		if (evaluator) {
+			evaluator->play(move);
+		} else {
+			board->makeMove(move);
+			board->forceFlipTurn(); // skipping opponent's turn
+		}
+		int childScore = DFS1pAux(board, depth+1, maxDepth, heatMap, curLine, bestLine, bestDist, evaluator);
+		if (childScore < score) {
+			score = childScore;
+			bestMove = move;
+		}
+
+		// Unsimulate the move (this also restores the turn)
+		curLine.pop_back();
+		if (evaluator) {
+			evaluator->undo();
+		} else {
+			board->undoLastMove();
+		}
+
+		// The score of an unfinished subtree must not be stored
+		if (searchAborted) return TranspositionTable::noScore;
+	}
+
+	if (useTranspositionTable) {
+		transpositionTable.store(key, maxDepth - depth, score, bestMove);
+	}
+	return score;
+}
+
+int DFS1P::searchRootParallel(int maxDepth, int (&heatMap)[6][8][8], std::vector<Closedfish::Move>& bestLine, int& bestDist) {
+	MoveList rootMoves;
+	generateSearchedMoves(currentBoard, 0, {}, rootMoves);
+
+	// Score and best line of every root move
+	std::vector<int> scores(rootMoves.size(), TranspositionTable::noScore);
+	std::vector<std::vector<Closedfish::Move>> lines(rootMoves.size());
+
+	// Workers take root moves from a shared counter until none are left
+	std::atomic<int> nextMove(0);
+	auto worker = [&]() {
+		CFBoard board = *currentBoard;
+		std::unique_ptr<HeatmapEvaluator> evaluator;
+		if (evaluationMode == EvaluationMode::INCREMENTAL) {
+			evaluator.reset(new HeatmapEvaluator(board, heatMap));
+		}
+		std::vector<Closedfish::Move> curLine;
+		curLine.reserve(maxDepth);
+		int i;
+		while ((i = nextMove.fetch_add(1)) < rootMoves.size() && !searchAborted) {
+			uint16_t move = rootMoves[i];
+			// Lines scoring as the best finished root move are still needed, an
+			// earlier root move wins ties
+			int dist = sharedCutoff.load();
+
+			curLine.push_back(std::make_tuple(CFMove::startTile(move), CFMove::endTile(move), 0.0));
+			if (evaluator) {
+				evaluator->play(move);
+			} else {
+				board.makeMove(move);
+				board.forceFlipTurn(); // skipping opponent's turn
+			}
+			scores[i] = DFS1pAux(&board, 1, maxDepth, heatMap, curLine, lines[i], dist, evaluator.get());
+			if (evaluator) {
+				evaluator->undo();
+			} else {
+				board.undoLastMove();
+			}
 			curLine.pop_back();
-			currentBoard->undoLastMove();
-			currentBoard->forceFlipTurn();
+
+			// Lower the bound shared with the other threads
+			int cutoff = sharedCutoff.load();
+			while (scores[i] < cutoff - 1 && !sharedCutoff.compare_exchange_weak(cutoff, scores[i] + 1));
 		}
+	};
+
+	sharedCutoff = TranspositionTable::noScore;
+	std::vector<std::thread> pool;
+	for (int t = 1; t < std::min(threads, rootMoves.size()); t++) {
+		pool.emplace_back(worker);
+	}
+	worker();
+	for (std::thread &thread : pool) {
+		thread.join();
+	}
+	sharedCutoff = TranspositionTable::noScore;
+
+	if (searchAborted) return TranspositionTable::noScore;
+
+	// Same choice as the single-threaded search: the first root move with the
+	// lowest score
+	int best = -1;
+	for (int i = 0; i < rootMoves.size(); i++) {
+		if (scores[i] < bestDist) {
+			bestDist = scores[i];
+			best = i;
+		}
+	}
+	if (best == -1) return TranspositionTable::noScore;
+
+	bestLine = lines[best];
+	if (useTranspositionTable) {
+		transpositionTable.store(currentBoard->getHash() ^ heatmapKey, maxDepth, bestDist, rootMoves[best]);
 	}
+	return bestDist;
 }
 
 Closedfish::Move DFS1P::getNextMove() {
 	int heatMap[6][8][8];
 	memset(heatMap, 0, sizeof(heatMap));
+	searchedNodes = 0;
+	completedDepth = 0;
 
 	// Check opponent blundering
     bool player = currentBoard->getCurrentPlayer();
@@ -174,69 +362,72 @@ Closedfish::Move DFS1P::getNextMove() {
 		return std::make_tuple(0,0,0);
 	}
 
-	// Build the weak pawns
-	uint64_t weakPawns = 0;
-	int weakPawnsNumProtect = 1e9;
-	for (int tile = 0; tile < 64; tile++) {
-		// Only consider opponent pawns
-		if (currentBoard->getPieceFromCoords(tile) != (!currentBoard->getCurrentPlayer()))
-			continue;
-		int numProtect = WeakPawns::nbProtectingPieces(*currentBoard, tile);
-		if (numProtect < weakPawnsNumProtect) {
-			weakPawns = 0;
-			weakPawnsNumProtect = WeakPawns::nbProtectingPieces(*currentBoard, tile);
-			weakPawns |= (1<<tile%8);
-		} else if (numProtect == weakPawnsNumProtect) {
-			weakPawns |= (1<<tile%8);
-		}
-	}
+	// Build the weak pawns, only considering opponent pawns
+	uint64_t weakPawns = WeakPawns::weakestPawnFiles(*currentBoard, !player);
 
 	// Build the heatmap
-	Heatmap::addHeatMap(*currentBoard, heatMap, weakPawns);
-
-	// CUSTOMIZABLE MAX DEPTH FOR DFS, CAPPED AT 4 CURRENTLY
-	int maxDepth = 3;
-
-	// Get all possible moves
-	std::vector<Closedfish::Move> ansLine;
-	std::vector<std::vector<Closedfish::Move>> possibleLines;
-	int minDist = 1e9;
-
-	// Put all possible lines into possibleLines
-	DFS1pAux(currentBoard, 0, maxDepth, {}, possibleLines);
-
-	// Iterate all lines
-	for (auto line: possibleLines) {
-		// Simulate all move in a line
-		for (auto move: line) {
-			currentBoard->movePiece(std::get<0>(move), std::get<1>(move));
-			currentBoard->forceFlipTurn(); // one-person dfs so we assume the opponent doesn't move
+	int16_t flatHeatMap[6][64];
+	Heatmap::buildHeatMap(*currentBoard, flatHeatMap, weakPawns);
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		for (int tile = 0; tile < 64; tile++) {
+			heatMap[halfPieceId][tile / 8][tile % 8] = flatHeatMap[halfPieceId][tile];
 		}
-
-		// if (currentBoard->naiveCheckCheck(currentBoard->getCurrentPlayer())) {
-		//	 cout << "REDFLAG: SHOULDN'T BE IN CHECK\n";
-		//	 cout << "dist after: " << distFromHeatmap(*currentBoard, heatMap) << '\n';
-		//	 cout << currentBoard->getRepr();
-		//	 cout << currentBoard->toFEN();
-		//	 cout << "in check: " << currentBoard->naiveCheckCheck(currentBoard->getCurrentPlayer()) << '\n';
-		// }
-
-		// Check if the moves make us closer to the heatMap
-		if (distFromHeatmap(*currentBoard, heatMap) < minDist) {
-			minDist = distFromHeatmap(*currentBoard, heatMap);
-			// If yes then update the most potential line
-			ansLine = line;
+	}
+	heatmapKey = heatmapSignature(heatMap);
+	transpositionTable.newSearch();
+
+	// Iterative deepening: every depth searches the best line of the previous
+	// one first, until the depth, time or node limit is reached
+	searchStart = std::chrono::steady_clock::now();
+	searchAborted = false;
+	previousLine.clear();
+	for (int maxDepth = 1; maxDepth <= std::max(1, searchLimits.maxDepth); maxDepth++) {
+		std::vector<Closedfish::Move> curLine, bestLine;
+		curLine.reserve(maxDepth);
+		int bestDist = TranspositionTable::noScore;
+
+		// Same position and heatmap as an earlier search: reuse its best move
+		TranspositionTable::Entry rootEntry;
+		if (useTranspositionTable && transpositionTable.probe(currentBoard->getHash() ^ heatmapKey, maxDepth, rootEntry) && rootEntry.bestMove) {
+			bestLine.push_back(std::make_tuple(CFMove::startTile(rootEntry.bestMove), CFMove::endTile(rootEntry.bestMove), 0.0));
+		} else {
+			// The first depth always finishes, so that there is a move to return
+			checkLimits = maxDepth > 1;
+			if (threads > 1) {
+				searchRootParallel(maxDepth, heatMap, bestLine, bestDist);
+			} else if (evaluationMode == EvaluationMode::INCREMENTAL) {
+				HeatmapEvaluator evaluator(*currentBoard, heatMap);
+				DFS1pAux(currentBoard, 0, maxDepth, heatMap, curLine, bestLine, bestDist, &evaluator);
+			} else {
+				DFS1pAux(currentBoard, 0, maxDepth, heatMap, curLine, bestLine, bestDist);
+			}
+			if (searchAborted) break;
 		}
+		// No line of this depth
+		if (bestLine.empty()) break;
 
-		// Undo all simulated moves after calculating
-		for (auto move: line) {
-			currentBoard->undoLastMove();
-			currentBoard->forceFlipTurn();
-		}
+		previousLine = bestLine;
+		completedDepth = maxDepth;
+		CF_LOG_DEBUG("DFS1P depth ", maxDepth, " distance ", bestDist, " nodes ", getSearchedNodes(), " move ",
+								 std::get<0>(bestLine[0]), "-", std::get<1>(bestLine[0]));
 	}
 
-	// Return the first move in the potential line
-	return ansLine[0];
+	// No move that fits the one-person search
+	if (previousLine.empty()) {
+		return std::make_tuple(0, 0, 0.0);
+	}
+	// Return the first move of the best line of the last finished depth
+	return previousLine[0];
+}
+
+bool DFS1P::searchLimitReached(uint64_t nodes) {
+	if (searchLimits.maxNodes && nodes > searchLimits.maxNodes) return true;
+	// Reading the clock every 64 positions is enough, evaluations are slower
+	if (searchLimits.maxTime > 0 && (nodes & 63) == 0) {
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - searchStart;
+		return elapsed.count() >= searchLimits.maxTime;
+	}
+	return false;
 }
 
 void DFS1P::testDFS() {
@@ -4,16 +4,42 @@
 #include <CFBoard.h>
 #include <EngineWrapper.h>
 #include <Heatmap.h>
+#include <HeatmapEvaluator.h>
+#include <Log.h>
+#include <PieceDistances.h>
+#include <TranspositionTable.h>
 #include <WeakPawns.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <queue>
+#include <thread>
 #include <tuple>
 #include <vector>
 #include <iostream>
 
 class DFS1P : public Closedfish::ChessEngine {
 public:
+	/**
+	 * @brief Selects how distFromTileToTilesAsPiece computes the distances.
+	 *
+	 * BFS is the original search over getLegalMoves, tile by tile. FLOOD_FILL
+	 * expands whole bitboards per move and caches the results (see
+	 * PieceDistances.h).
+	 */
+	enum class DistanceMode { BFS, FLOOD_FILL };
+
+	/**
+	 * @brief Selects how the search evaluates the positions it reaches.
+	 *
+	 * FULL calls distFromHeatmap on every position. INCREMENTAL keeps a
+	 * HeatmapEvaluator along the searched line and only recomputes the terms
+	 * of the pieces a move affects. Both give the same distances.
+	 */
+	enum class EvaluationMode { FULL, INCREMENTAL };
+
 	/**
 	 * @brief This function returns the next move of the current position.
 	 *
@@ -67,21 +93,124 @@ public:
 	int distFromHeatmap(CFBoard &board, int (&heatMap)[6][8][8]);
 
 	/**
-* @brief This function takes a pointer to a CFBoard, the current depth, the
-maximum depth, the current line, all possible lines, and performs DFS to search
-all possible next moves.
-	*
-* @param currentBoard : <CFBoard*> current board.
-* @param depth : <int> current depth in the DFS.
-	* @param maxDepth : <int> maximum depth in the DFS.
-	* @param curLine : <vector<tuple<int, int, float>> a vector representing the
-current line we are searching
-	* @param possibleLines : <vector<vector<tuple<int, int, float>>>> a vector
-storing all lines that we have searched.
-*/
-	void DFS1pAux(CFBoard *currentBoard, int depth, int maxDepth,
-								std::vector<Closedfish::Move> curLine,
-								std::vector<std::vector<Closedfish::Move>> &possibleLines);
+	 * @brief This function performs a DFS over the moves of the current player
+	 * (the opponent never moves) and evaluates the positions reached at
+	 * maxDepth against the heatmap, keeping only the closest line.
+	 *
+	 * @param board : <CFBoard*> current board, left unchanged.
+	 * @param depth : <int> current depth in the DFS.
+	 * @param maxDepth : <int> maximum depth in the DFS.
+	 * @param heatMap : <int[6][8][8]> heatMap of the searched position.
+	 * @param curLine : <vector<tuple<int, int, float>>> the moves leading from
+	 * the searched position to board.
+	 * @param bestLine : <vector<tuple<int, int, float>>> the closest line found
+	 * so far, updated when a closer one is found.
+	 * @param bestDist : <int> the distance of bestLine to the heatmap.
+	 * @param evaluator : <HeatmapEvaluator*> if not null, evaluator following
+	 * board: moves are played through it and leaves take its distance
+	 * instead of calling distFromHeatmap.
+	 *
+	 * @return The smallest distance of a line below board,
+	 * TranspositionTable::noScore if there is none.
+	 */
+	int DFS1pAux(CFBoard *board, int depth, int maxDepth,
+							 int (&heatMap)[6][8][8],
+							 std::vector<Closedfish::Move> &curLine,
+							 std::vector<Closedfish::Move> &bestLine, int &bestDist,
+							 HeatmapEvaluator *evaluator = nullptr);
 
 	void testDFS();
+
+	/**
+	 * @brief Changes the distance computation, FLOOD_FILL by default.
+	 */
+	void setDistanceMode(DistanceMode mode);
+
+	/**
+	 * @brief Changes the evaluation of the search, INCREMENTAL by default.
+	 */
+	void setEvaluationMode(EvaluationMode mode);
+
+	/**
+	 * @brief Sets the number of threads of the search. With more than one, the
+	 * moves of the searched position are shared between threads, each working
+	 * on its own copy of the board. The chosen move does not depend on it.
+	 *
+	 * @param threadCount : <int> number of threads, 1 by default.
+	 */
+	void setThreads(int threadCount);
+
+	/**
+	 * @brief Resizes the transposition table, which keeps subtrees and leaf
+	 * evaluations between searches. 0 disables it.
+	 *
+	 * @param sizeMB : <size_t> maximum size of the table in megabytes.
+	 */
+	void setHashSize(std::size_t sizeMB);
+
+	/**
+	 * @brief Flag another thread sets to end the search early, nullptr for none
+	 * (the default). Once it is set, getNextMove returns the best move of the
+	 * last depth it finished, start == end if it finished none. Not owned.
+	 */
+	void setStopFlag(const std::atomic<bool> *flag) { stopFlag = flag; }
+
+	/**
+	 * @brief Hashes the content of a heatmap, so that positions evaluated
+	 * against different heatmaps get different transposition table keys.
+	 */
+	static uint64_t heatmapSignature(int (&heatMap)[6][8][8]);
+
+	/**
+	 * @brief Statistics of the last getNextMove call: deepest finished search
+	 * (whose best move was returned) and number of positions searched.
+	 */
+	int getCompletedDepth() const { return completedDepth; }
+	uint64_t getSearchedNodes() const { return searchedNodes; }
+
+private:
+	/**
+	 * @brief Whether the time or node budget of searchLimits is spent, nodes
+	 * positions being searched so far.
+	 */
+	bool searchLimitReached(uint64_t nodes);
+
+	/**
+	 * @brief Fills moveList with the moves searched from board: legal
+	 * moves that do not capture and do not land on a square attacked by an
+	 * opponent pawn, only promoting to a queen. When curLine follows the best
+	 * line of the previous depth, its next move comes first.
+	 */
+	void generateSearchedMoves(CFBoard *board, int depth,
+														 const std::vector<Closedfish::Move> &curLine,
+														 MoveList &moveList);
+
+	/**
+	 * @brief Same result as DFS1pAux from the root of currentBoard, with the
+	 * root moves shared between threads.
+	 */
+	int searchRootParallel(int maxDepth, int (&heatMap)[6][8][8],
+												 std::vector<Closedfish::Move> &bestLine,
+												 int &bestDist);
+
+	TranspositionTable transpositionTable;
+	bool useTranspositionTable = true;
+	uint64_t heatmapKey = 0; // heatmapSignature of the current search
+
+	// Iterative deepening state
+	std::vector<Closedfish::Move> previousLine; // best line of the last finished depth
+	std::chrono::steady_clock::time_point searchStart;
+	std::atomic<uint64_t> searchedNodes{0};
+	bool checkLimits = false;
+	std::atomic<bool> searchAborted{false};
+	const std::atomic<bool> *stopFlag = nullptr;
+	int completedDepth = 0;
+
+	DistanceMode distanceMode = DistanceMode::FLOOD_FILL;
+	EvaluationMode evaluationMode = EvaluationMode::INCREMENTAL;
+
+	// Parallel search state
+	int threads = 1;
+	// Scores from this one cannot beat a finished root move
+	std::atomic<int> sharedCutoff{TranspositionTable::noScore};
 };
\ No newline at end of file
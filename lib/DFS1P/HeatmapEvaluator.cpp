@@ -0,0 +1,99 @@
+#include "HeatmapEvaluator.h"
+
+HeatmapEvaluator::HeatmapEvaluator(CFBoard &searchedBoard, int (&heatMap)[6][8][8])
+		: board(searchedBoard), color(searchedBoard.getCurrentPlayer()) {
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		for (int i = 0; i < 8; i++) {
+			for (int j = 0; j < 8; j++) {
+				if (heatMap[halfPieceId][i][j] != 0) {
+					hotTiles[halfPieceId].push_back({i * 8 + j, heatMap[halfPieceId][i][j]});
+				}
+			}
+		}
+	}
+
+	PieceDistances::BoardInfo info = PieceDistances::describe(board);
+	uint64_t pieces = board.getColorBitBoard(color);
+	while (pieces) {
+		recompute(__builtin_ctzll(pieces), info);
+		pieces &= pieces - 1;
+	}
+	saved.clear();
+}
+
+void HeatmapEvaluator::recompute(int tile, const PieceDistances::BoardInfo &info) {
+	saved.push_back({tile, terms[tile]});
+	distance -= terms[tile].value;
+	terms[tile] = Term();
+
+	int pieceId = board.getPieceFromCoords(tile);
+	if (pieceId == -1 || (pieceId & 1) != color) {
+		return;
+	}
+	int halfPieceId = pieceId >> 1;
+	if (hotTiles[halfPieceId].empty()) {
+		return;
+	}
+
+	std::array<int, 64> dist = PieceDistances::fromTile(board, info, halfPieceId, tile, &terms[tile].reach);
+	for (const std::pair<int, int> &hot : hotTiles[halfPieceId]) {
+		int tileDist = dist[hot.first];
+		terms[tile].value += hot.second * (tileDist != -1 ? tileDist : COEFF_SEPARATED);
+	}
+	distance += terms[tile].value;
+}
+
+bool HeatmapEvaluator::isInCheck() {
+	uint64_t allyKing = board.getPieceColorBitBoard(10 | color);
+	if (!allyKing) {
+		return false;
+	}
+	uint64_t occupancy = board.getColorBitBoard(0) | board.getColorBitBoard(1);
+	return board.attackersTo(__builtin_ctzll(allyKing), occupancy) & board.getColorBitBoard(!color);
+}
+
+void HeatmapEvaluator::play(uint16_t move) {
+	int startTile = CFMove::startTile(move), endTile = CFMove::endTile(move);
+	// King moves change the pins and the danger map, captures the pawn attacks
+	bool global = (board.getPieceFromCoords(startTile) >> 1) == 5 ||
+								board.getPieceFromCoords(endTile) != -1 ||
+								CFMove::type(move) == CFMove::EN_PASSANT || isInCheck();
+	int enPassantTarget = board.getEnPassantTarget();
+
+	played.push_back({static_cast<int>(saved.size()), distance, changedTiles});
+	board.makeMove(move);
+	board.forceFlipTurn(); // the opponent does not move
+
+	global = global || isInCheck() || enPassantTarget != board.getEnPassantTarget();
+	changedTiles |= global ? ~0ull : (1ull << startTile) | (1ull << endTile);
+}
+
+int HeatmapEvaluator::getDistance() {
+	if (changedTiles) {
+		PieceDistances::BoardInfo info = PieceDistances::describe(board);
+		// Tiles with a piece, or with the term of a piece that left
+		uint64_t tiles = board.getColorBitBoard(color) | changedTiles;
+		while (tiles) {
+			int tile = __builtin_ctzll(tiles);
+			tiles &= tiles - 1;
+			if (((changedTiles >> tile) & 1) || (terms[tile].reach & changedTiles)) {
+				if (terms[tile].reach || ((board.getColorBitBoard(color) >> tile) & 1)) {
+					recompute(tile, info);
+				}
+			}
+		}
+		changedTiles = 0;
+	}
+	return distance;
+}
+
+void HeatmapEvaluator::undo() {
+	board.undoLastMove();
+	while (static_cast<int>(saved.size()) > played.back().savedStart) {
+		terms[saved.back().first] = saved.back().second;
+		saved.pop_back();
+	}
+	distance = played.back().distance;
+	changedTiles = played.back().changedTiles;
+	played.pop_back();
+}
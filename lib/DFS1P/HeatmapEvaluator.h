@@ -0,0 +1,93 @@
+#pragma once
+
+#include <CFBoard.h>
+#include <PieceDistances.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+/*---DESCRIPTION---
+
+Incremental version of DFS1P::distFromHeatmap for the one-person search.
+
+The distance of a board to a heatmap is a sum of one term per piece of the
+player to move: the heat of every hot tile of its type times the number of
+moves the piece needs to reach it. The evaluator keeps these terms, and when
+a move is played (the opponent never moves) only recomputes:
+- the term of the moved piece,
+- the terms of the pieces whose distances looked at the start or end tile of
+  the move (PieceDistances reach), which includes the pins on the king line,
+- every term when the king moves, when a piece is captured, when the player
+  is or was in check, or when the en passant target changes.
+The terms are only updated when the distance is asked for, so positions whose
+distance is found in the transposition table cost no update. Undoing a move
+restores the saved terms.
+
+*/
+
+class HeatmapEvaluator {
+public:
+	// Value added per heat point when the hot tile is unreachable
+	static const int COEFF_SEPARATED = 10;
+
+	/**
+	 * @brief Computes every term of the current position of searchedBoard.
+	 *
+	 * @param searchedBoard : <CFBoard> board searched, moves must go through
+	 * play and undo while the evaluator is used.
+	 * @param heatMap : <int[6][8][8]> heatMap the distance is measured to.
+	 */
+	HeatmapEvaluator(CFBoard &searchedBoard, int (&heatMap)[6][8][8]);
+
+	/**
+	 * @brief Same value as DFS1P::distFromHeatmap on the current board.
+	 */
+	int getDistance();
+
+	/**
+	 * @brief Plays a move of the player to move and gives the turn back to
+	 * them (CFBoard::makeMove then CFBoard::forceFlipTurn), updating the terms.
+	 */
+	void play(uint16_t move);
+
+	/**
+	 * @brief Undoes the last move given to play.
+	 */
+	void undo();
+
+private:
+	struct Term {
+		int value = 0;
+		uint64_t reach = 0; // tiles the term depends on
+	};
+
+	/**
+	 * @brief Saves the term of tile for undo, then computes it again, info
+	 * describing the current board.
+	 */
+	void recompute(int tile, const PieceDistances::BoardInfo &info);
+
+	bool isInCheck();
+
+	CFBoard &board;
+	bool color;
+	// Hot tiles of every piece type, with their heat
+	std::vector<std::pair<int, int>> hotTiles[6];
+
+	Term terms[64];
+	int distance = 0;
+
+	// Tiles changed by the moves played since the terms were last updated,
+	// every tile after a move changing all the terms
+	uint64_t changedTiles = 0;
+
+	// Undo stack, one element per move: where its saved terms start, and the
+	// distance and changed tiles before it
+	struct Played {
+		int savedStart;
+		int distance;
+		uint64_t changedTiles;
+	};
+	std::vector<std::pair<int, Term>> saved;
+	std::vector<Played> played;
+};
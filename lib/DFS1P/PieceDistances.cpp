@@ -0,0 +1,325 @@
+#include "PieceDistances.h"
+#include <AttackTables.h>
+
+namespace PieceDistances {
+
+namespace {
+
+const uint64_t notFileA = ~0x0101010101010101ull;
+const uint64_t notFileH = ~0x8080808080808080ull;
+const uint64_t notFilesAB = ~0x0303030303030303ull;
+const uint64_t notFilesGH = ~0xC0C0C0C0C0C0C0C0ull;
+
+// Shifts towards higher tiles for positive amounts
+inline uint64_t shift(uint64_t board, int amount) {
+	return amount > 0 ? board << amount : board >> -amount;
+}
+
+uint64_t knightSpan(uint64_t board) {
+	return ((board << 17) & notFileA) | ((board >> 15) & notFileA) |
+				 ((board << 15) & notFileH) | ((board >> 17) & notFileH) |
+				 ((board << 10) & notFilesAB) | ((board >> 6) & notFilesAB) |
+				 ((board << 6) & notFilesGH) | ((board >> 10) & notFilesGH);
+}
+
+uint64_t kingSpan(uint64_t board) {
+	uint64_t row = board | ((board << 1) & notFileA) | ((board >> 1) & notFileH);
+	return (row | (row << 8) | (row >> 8)) & ~board;
+}
+
+/**
+ * @brief Tiles attacked in one direction by sliders on every tile of board,
+ * blockers included (Kogge-Stone fill through the empty tiles).
+ *
+ * @param amount : tile difference of one step in the direction.
+ * @param wrap : tiles a step can land on without wrapping around the board.
+ */
+uint64_t rayAttacks(uint64_t board, uint64_t empty, int amount, uint64_t wrap) {
+	empty &= wrap;
+	board |= empty & shift(board, amount);
+	empty &= shift(empty, amount);
+	board |= empty & shift(board, 2 * amount);
+	empty &= shift(empty, 2 * amount);
+	board |= empty & shift(board, 4 * amount);
+	return shift(board, amount) & wrap;
+}
+
+uint64_t cardinalSpan(uint64_t board, uint64_t empty) {
+	return rayAttacks(board, empty, 1, notFileA) |
+				 rayAttacks(board, empty, -1, notFileH) |
+				 rayAttacks(board, empty, 8, ~0ull) |
+				 rayAttacks(board, empty, -8, ~0ull);
+}
+
+uint64_t diagonalSpan(uint64_t board, uint64_t empty) {
+	return rayAttacks(board, empty, 9, notFileA) |
+				 rayAttacks(board, empty, 7, notFileH) |
+				 rayAttacks(board, empty, -7, notFileA) |
+				 rayAttacks(board, empty, -9, notFileH);
+}
+
+/**
+ * @brief Tiles whose occupancy changes the moves of a pawn on tile: its
+ * pushes and its captures.
+ */
+uint64_t pawnReach(int tile, bool color) {
+	int forward = color ? 8 : -8;
+	uint64_t reach = AttackTables::pawnAttacks[color][tile];
+	if (tile + forward >= 0 && tile + forward < 64) {
+		reach |= 1ull << (tile + forward);
+	}
+	// Double push from the starting row
+	if ((tile >> 3) == (color ? 1 : 6)) {
+		reach |= 1ull << (tile + 2 * forward);
+	}
+	return reach;
+}
+
+struct CacheEntry {
+	uint64_t occupancy;
+	uint64_t reach;
+	uint64_t unsafe;
+	uint64_t firstStep;
+	uint64_t checkMask;
+	uint8_t pieceId;
+	uint8_t startTile;
+	int8_t enPassantTarget;
+	bool valid;
+	int8_t dist[64];
+};
+
+const int cacheSize = 1024; // power of two
+
+struct Cache {
+	CacheEntry entries[cacheSize] = {};
+	CacheStats stats;
+};
+
+thread_local Cache cache;
+
+} // namespace
+
+uint64_t pawnAttackSpan(uint64_t pawnBoard, bool color) {
+	// White pawns go towards lower tiles, black pawns towards higher ones
+	if (color) {
+		return ((pawnBoard << 9) & notFileA) | ((pawnBoard << 7) & notFileH);
+	}
+	return ((pawnBoard >> 7) & notFileA) | ((pawnBoard >> 9) & notFileH);
+}
+
+BoardInfo describe(CFBoard &board) {
+	BoardInfo info;
+	bool currentTurn = board.getCurrentPlayer(); // 0: white, 1: black
+	info.color = currentTurn;
+	info.occupancy = board.getColorBitBoard(0) | board.getColorBitBoard(1);
+	info.unsafe = pawnAttackSpan(board.getPieceColorBitBoard(!currentTurn), !currentTurn);
+	info.targets = ~info.occupancy & ~info.unsafe;
+	info.checkMask = ~0ull;
+	info.pinned = 0;
+	info.kingTile = -1;
+
+	uint64_t allyKing = board.getPieceColorBitBoard(10 | currentTurn);
+	if (!allyKing) {
+		return info;
+	}
+	int kingTile = __builtin_ctzll(allyKing);
+	info.kingTile = kingTile;
+	uint64_t opponent = board.getColorBitBoard(!currentTurn);
+	uint64_t checkers = board.attackersTo(kingTile, info.occupancy) & opponent;
+	if (checkers & (checkers - 1)) {
+		info.checkMask = 0;
+	} else if (checkers) {
+		info.checkMask = checkers | AttackTables::between[kingTile][__builtin_ctzll(checkers)];
+	}
+
+	// Opponent sliders aligned with the king, behind exactly one of our pieces
+	uint64_t queens = board.getPieceColorBitBoard(8 | !currentTurn);
+	uint64_t snipers =
+			(AttackTables::rookAttacks(kingTile, 0) & (board.getPieceColorBitBoard(6 | !currentTurn) | queens)) |
+			(AttackTables::bishopAttacks(kingTile, 0) & (board.getPieceColorBitBoard(4 | !currentTurn) | queens));
+	for (; snipers; snipers &= snipers - 1) {
+		uint64_t blockers = AttackTables::between[kingTile][__builtin_ctzll(snipers)] & info.occupancy;
+		if (blockers && !(blockers & (blockers - 1)) && !(blockers & opponent)) {
+			info.pinned |= blockers;
+		}
+	}
+	return info;
+}
+
+std::array<int, 64> fromTile(CFBoard &board, int halfPieceId, int startTile,
+														 uint64_t *reach) {
+	return fromTile(board, describe(board), halfPieceId, startTile, reach);
+}
+
+std::array<int, 64> fromTile(CFBoard &board, const BoardInfo &info,
+														 int halfPieceId, int startTile,
+														 uint64_t *reach) {
+	bool currentTurn = info.color;
+	int pieceId = 2 * halfPieceId + currentTurn;
+	uint64_t occupancy = info.occupancy;
+	uint64_t empty = ~occupancy;
+	uint64_t unsafe = info.unsafe;
+	uint64_t targets = info.targets;
+	// Later steps start from empty tiles, which are never pinned: only a check
+	// restricts them
+	uint64_t checkMask = info.checkMask;
+	int kingTile = info.kingTile;
+
+	// The first step is a real move, with all the legality checks. Pawns and
+	// kings have special cases (en passant, castling, attacked tiles) left to
+	// getLegalMoves, the other pieces only need the check and the pin
+	uint64_t firstStep;
+	switch (halfPieceId) {
+	case 1:
+		firstStep = AttackTables::knightAttacks[startTile];
+		break;
+	case 2:
+		firstStep = AttackTables::bishopAttacks(startTile, occupancy);
+		break;
+	case 3:
+		firstStep = AttackTables::rookAttacks(startTile, occupancy);
+		break;
+	case 4:
+		firstStep = AttackTables::bishopAttacks(startTile, occupancy) | AttackTables::rookAttacks(startTile, occupancy);
+		break;
+	default:
+		firstStep = board.getLegalMoves(pieceId, startTile);
+		break;
+	}
+	firstStep &= targets;
+	if (halfPieceId != 0 && halfPieceId != 5) {
+		firstStep &= checkMask;
+		if ((info.pinned >> startTile) & 1) {
+			firstStep &= AttackTables::line[kingTile][startTile];
+		}
+	}
+
+	// The later steps of a pawn can take en passant: its distances also depend
+	// on the target, which does not matter to the other pieces
+	int8_t enPassantTarget = static_cast<int8_t>(halfPieceId == 0 ? board.getEnPassantTarget() : -1);
+
+	uint64_t hash = (occupancy ^ (unsafe * 0x9E3779B97F4A7C15ull) ^ (firstStep * 0xC2B2AE3D27D4EB4Full) ^
+									 checkMask) * 0xFF51AFD7ED558CCDull;
+	hash ^= static_cast<uint64_t>(pieceId << 6 | startTile | (enPassantTarget + 1) << 12) * 0xD6E8FEB86659FD93ull;
+	CacheEntry &entry = cache.entries[(hash >> 32) & (cacheSize - 1)];
+
+	std::array<int, 64> dist;
+	if (entry.valid && entry.occupancy == occupancy && entry.unsafe == unsafe &&
+			entry.firstStep == firstStep && entry.checkMask == checkMask &&
+			entry.pieceId == pieceId && entry.startTile == startTile &&
+			entry.enPassantTarget == enPassantTarget) {
+		cache.stats.hits++;
+		for (int i = 0; i < 64; i++) {
+			dist[i] = entry.dist[i];
+		}
+		if (reach) {
+			*reach = entry.reach;
+		}
+		return dist;
+	}
+	cache.stats.misses++;
+
+	// Tiles looked at by the first step, occupied or not, and the line of a
+	// possible pin
+	uint64_t touched = 0;
+	switch (halfPieceId) {
+	case 0:
+		touched = pawnReach(startTile, currentTurn);
+		break;
+	case 1:
+		touched = AttackTables::knightAttacks[startTile];
+		break;
+	case 2:
+		touched = AttackTables::bishopAttacks(startTile, occupancy);
+		break;
+	case 3:
+		touched = AttackTables::rookAttacks(startTile, occupancy);
+		break;
+	case 4:
+		touched = AttackTables::bishopAttacks(startTile, occupancy) | AttackTables::rookAttacks(startTile, occupancy);
+		break;
+	case 5:
+		touched = ~0ull;
+		break;
+	}
+	// A pin needs an opponent slider on the line, and the opponent does not move
+	if (kingTile != -1 && kingTile != startTile) {
+		uint64_t line = AttackTables::line[kingTile][startTile];
+		bool cardinal = (kingTile >> 3) == (startTile >> 3) || (kingTile & 7) == (startTile & 7);
+		uint64_t pinners = board.getPieceColorBitBoard(8 | !currentTurn) |
+											 board.getPieceColorBitBoard((cardinal ? 6 : 4) | !currentTurn);
+		if (line & pinners) {
+			touched |= line;
+		}
+	}
+
+	dist.fill(-1);
+	dist[startTile] = 0;
+	uint64_t visited = 1ull << startTile;
+	uint64_t frontier = firstStep;
+	for (int step = 1; frontier; step++) {
+		visited |= frontier;
+		uint64_t ring = frontier;
+		while (ring) {
+			dist[__builtin_ctzll(ring)] = step;
+			ring &= ring - 1;
+		}
+
+		// Every tile reachable in one more move
+		uint64_t next = 0;
+		switch (halfPieceId) {
+		case 0: // pawn: at most a couple of tiles, the pattern has special cases
+			for (uint64_t tiles = frontier; tiles; tiles &= tiles - 1) {
+				next |= board.getLegalMoves(pieceId, __builtin_ctzll(tiles));
+				touched |= pawnReach(__builtin_ctzll(tiles), currentTurn);
+			}
+			break;
+		case 1:
+			next = knightSpan(frontier);
+			break;
+		case 2:
+			next = diagonalSpan(frontier, empty);
+			break;
+		case 3:
+			next = cardinalSpan(frontier, empty);
+			break;
+		case 4:
+			next = diagonalSpan(frontier, empty) | cardinalSpan(frontier, empty);
+			break;
+		case 5:
+			next = kingSpan(frontier);
+			break;
+		}
+		touched |= next;
+		frontier = next & targets & checkMask & ~visited;
+	}
+	touched |= visited;
+
+	entry.occupancy = occupancy;
+	entry.reach = touched;
+	entry.unsafe = unsafe;
+	entry.firstStep = firstStep;
+	entry.checkMask = checkMask;
+	entry.pieceId = static_cast<uint8_t>(pieceId);
+	entry.startTile = static_cast<uint8_t>(startTile);
+	entry.enPassantTarget = enPassantTarget;
+	entry.valid = true;
+	for (int i = 0; i < 64; i++) {
+		entry.dist[i] = static_cast<int8_t>(dist[i]);
+	}
+	if (reach) {
+		*reach = touched;
+	}
+	return dist;
+}
+
+CacheStats getCacheStats() { return cache.stats; }
+
+void clearCache() {
+	for (CacheEntry &entry : cache.entries) {
+		entry.valid = false;
+	}
+	cache.stats = CacheStats();
+}
+
+} // namespace PieceDistances
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <CFBoard.h>
+#include <array>
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Turn distances of a piece to every tile, as used by the DFS1P evaluation: how
+many moves a piece of the current player needs to reach each tile, moving
+only to empty tiles that no opponent pawn attacks, while the opponent does
+not move.
+
+The distances are computed by a bitboard flood fill. The tiles at distance k
+are found all at once from the tiles at distance k - 1: knight and king
+steps are whole-bitboard shifts, slider rays a Kogge-Stone fill stopped by
+the occupied tiles. The first step is the legal moves of the piece, so pins,
+checks and castling are taken into account like getLegalMoves does.
+
+Results are cached per thread by (piece, start tile, occupancy, pawn
+attacks, first step), so a piece that did not move between two evaluated
+positions with the same pieces is not filled again.
+
+*/
+
+namespace PieceDistances {
+
+/**
+ * @brief What fromTile needs to know about a position, whatever the piece:
+ * computed once for all the pieces of an evaluated position.
+ */
+struct BoardInfo {
+	bool color;					 // current player
+	uint64_t occupancy;
+	uint64_t unsafe;		 // tiles attacked by opponent pawns
+	uint64_t targets;		 // empty tiles no opponent pawn attacks
+	uint64_t checkMask;	 // tiles blocking a check, every tile if none
+	uint64_t pinned;		 // pieces of the current player pinned to their king
+	int kingTile;				 // -1 without a king
+};
+
+BoardInfo describe(CFBoard &board);
+
+/**
+ * @brief Distance (in moves) from startTile to every tile for a piece of the
+ * current player, -1 for unreachable tiles. Same result as a BFS over
+ * getLegalMoves.
+ *
+ * @param board : <CFBoard> current board.
+ * @param halfPieceId : <int> equal to half of pieceId (0: pawn, 1: knight, 2:
+ * bishop, 3: rook, 4: queen, 5: king).
+ * @param startTile : <int> starting tile (0: a8, 1: b8, ..., 63: h1).
+ * @param reach : if not null, set to the tiles whose occupancy the result
+ * depends on (every tile for a king, whose moves depend on the whole danger
+ * map). The result may also change when the player gets in or out of check,
+ * or when the en passant target changes.
+ *
+ * Results are cached per thread by everything they depend on, the en passant
+ * target included for pawns.
+ */
+std::array<int, 64> fromTile(CFBoard &board, int halfPieceId, int startTile,
+														 uint64_t *reach = nullptr);
+
+/**
+ * @brief Same as above, info being describe(board).
+ */
+std::array<int, 64> fromTile(CFBoard &board, const BoardInfo &info,
+														 int halfPieceId, int startTile,
+														 uint64_t *reach = nullptr);
+
+/**
+ * @brief Tiles attacked by the pawns of pawnBoard, of the given color.
+ */
+uint64_t pawnAttackSpan(uint64_t pawnBoard, bool color);
+
+struct CacheStats {
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+};
+
+/**
+ * @brief Cache statistics of the calling thread.
+ */
+CacheStats getCacheStats();
+
+/**
+ * @brief Empties the cache of the calling thread and resets its statistics.
+ */
+void clearCache();
+
+} // namespace PieceDistances
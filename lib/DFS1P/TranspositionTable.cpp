@@ -0,0 +1,88 @@
+#include "TranspositionTable.h"
+#include <algorithm>
+
+static_assert(sizeof(uint64_t) * 2 * TranspositionTable::bucketSize == 64,
+							"a bucket must fill exactly one cache line");
+
+const int32_t TranspositionTable::noScore;
+
+TranspositionTable::TranspositionTable(std::size_t sizeMB) { resize(sizeMB); }
+
+void TranspositionTable::resize(std::size_t sizeMB) {
+	// Largest power of two number of buckets fitting in sizeMB
+	std::size_t count = 1;
+	while (count * 2 * sizeof(Bucket) <= std::max<std::size_t>(sizeMB, 1) << 20) {
+		count *= 2;
+	}
+	buckets.reset(new Bucket[count]);
+	bucketCount = count;
+	mask = count - 1;
+	clear();
+}
+
+void TranspositionTable::clear() {
+	for (std::size_t i = 0; i < bucketCount; i++) {
+		for (Slot &slot : buckets[i].slots) {
+			slot.keyXorData.store(0, std::memory_order_relaxed);
+			slot.data.store(0, std::memory_order_relaxed);
+		}
+	}
+	generation = 0;
+}
+
+void TranspositionTable::newSearch() { generation++; }
+
+uint64_t TranspositionTable::pack(int depth, int32_t score, uint16_t bestMove,
+																	uint8_t generation) {
+	return static_cast<uint64_t>(static_cast<uint32_t>(score)) |
+				 static_cast<uint64_t>(bestMove) << 32 |
+				 static_cast<uint64_t>(static_cast<uint8_t>(depth)) << 48 |
+				 static_cast<uint64_t>(generation) << 56;
+}
+
+TranspositionTable::Entry TranspositionTable::unpack(uint64_t key,
+																										 uint64_t data) {
+	return {key, static_cast<int32_t>(static_cast<uint32_t>(data)),
+					static_cast<uint16_t>(data >> 32), static_cast<uint8_t>(data >> 48),
+					static_cast<uint8_t>(data >> 56)};
+}
+
+bool TranspositionTable::probe(uint64_t key, int depth, Entry &entry) const {
+	const Bucket &bucket = buckets[key & mask];
+	for (const Slot &slot : bucket.slots) {
+		uint64_t data = slot.data.load(std::memory_order_relaxed);
+		uint64_t keyXorData = slot.keyXorData.load(std::memory_order_relaxed);
+		if ((keyXorData ^ data) == key && static_cast<uint8_t>(data >> 48) == depth) {
+			entry = unpack(key, data);
+			return true;
+		}
+	}
+	return false;
+}
+
+void TranspositionTable::store(uint64_t key, int depth, int32_t score,
+															 uint16_t bestMove) {
+	Bucket &bucket = buckets[key & mask];
+	// Prefer entries of older searches, then shallow ones
+	auto worth = [this](uint64_t data) {
+		return (static_cast<uint8_t>(data >> 56) == generation ? 256 : 0) +
+					 static_cast<int>(static_cast<uint8_t>(data >> 48));
+	};
+	Slot *victim = &bucket.slots[0];
+	uint64_t victimData = victim->data.load(std::memory_order_relaxed);
+	for (Slot &slot : bucket.slots) {
+		uint64_t data = slot.data.load(std::memory_order_relaxed);
+		uint64_t keyXorData = slot.keyXorData.load(std::memory_order_relaxed);
+		if ((keyXorData ^ data) == key && static_cast<uint8_t>(data >> 48) == depth) {
+			victim = &slot;
+			break;
+		}
+		if (worth(data) < worth(victimData)) {
+			victim = &slot;
+			victimData = data;
+		}
+	}
+	uint64_t data = pack(depth, score, bestMove, generation);
+	victim->data.store(data, std::memory_order_relaxed);
+	victim->keyXorData.store(key ^ data, std::memory_order_relaxed);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+/*---DESCRIPTION---
+
+Fixed-size transposition table for the DFS1P search.
+
+The table is a power-of-two array of 64-byte buckets (one cache line each)
+holding four 16-byte entries. An entry remembers, for a position key and a
+remaining search depth, the score of the subtree and the first move of its
+best line. A probe touches a single cache line.
+
+Keys are built by the search (CFBoard::getHash mixed with a signature of the
+heatmap), so entries stay valid across consecutive getNextMove calls as long
+as the heatmap does not change.
+
+When a bucket is full, entries from older searches are replaced first, then
+the shallowest ones.
+
+The table can be shared by several search threads without locks: an entry is
+written as two 64-bit words, the data and the key XORed with the data. A probe
+only accepts an entry whose two words match, so an entry torn by two threads
+writing at the same time reads as missing.
+
+*/
+
+class TranspositionTable {
+public:
+	// Score of a position without any line of the searched depth below it
+	static const int32_t noScore = INT32_MAX;
+
+	struct Entry {
+		uint64_t key;
+		int32_t score;
+		uint16_t bestMove; // packed move (see MoveList.h), 0 if none
+		uint8_t depth;		 // remaining depth below the position
+		uint8_t generation;
+	};
+
+	static const int bucketSize = 4;
+
+	/**
+	 * @brief Allocates a table of at most sizeMB megabytes.
+	 */
+	explicit TranspositionTable(std::size_t sizeMB = 16);
+
+	/**
+	 * @brief Reallocates the table to at most sizeMB megabytes. Clears it.
+	 * Not thread safe.
+	 */
+	void resize(std::size_t sizeMB);
+
+	/**
+	 * @brief Forgets every entry. Not thread safe.
+	 */
+	void clear();
+
+	/**
+	 * @brief Starts a new search: entries stored from now on belong to a new
+	 * generation and older ones become the first to be replaced.
+	 */
+	void newSearch();
+	uint8_t getGeneration() const { return generation; }
+
+	/**
+	 * @brief Looks up the entry of a position at a remaining depth.
+	 *
+	 * @param entry : filled with a copy of the entry when it is found.
+	 *
+	 * @return whether the entry is in the table.
+	 */
+	bool probe(uint64_t key, int depth, Entry &entry) const;
+
+	/**
+	 * @brief Stores (or overwrites) the entry of a position at a remaining
+	 * depth, in the current generation.
+	 */
+	void store(uint64_t key, int depth, int32_t score, uint16_t bestMove);
+
+	std::size_t getBucketCount() const { return bucketCount; }
+
+private:
+	struct Slot {
+		std::atomic<uint64_t> keyXorData;
+		std::atomic<uint64_t> data;
+	};
+
+	struct alignas(64) Bucket {
+		Slot slots[bucketSize];
+	};
+
+	static uint64_t pack(int depth, int32_t score, uint16_t bestMove,
+											 uint8_t generation);
+	static Entry unpack(uint64_t key, uint64_t data);
+
+	std::unique_ptr<Bucket[]> buckets;
+	std::size_t bucketCount = 0;
+	uint64_t mask = 0;
+	uint8_t generation = 0;
+};
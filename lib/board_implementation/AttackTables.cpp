@@ -0,0 +1,210 @@
+#include "AttackTables.h"
+
+namespace AttackTables {
+
+Magic rookMagics[64];
+Magic bishopMagics[64];
+SliderMode sliderMode = SliderMode::LOOKUP;
+CheckMode checkMode = CheckMode::ATTACK_MAP;
+
+uint64_t knightAttacks[64];
+uint64_t kingAttacks[64];
+uint64_t pawnAttacks[2][64];
+uint64_t between[64][64];
+uint64_t line[64][64];
+
+namespace {
+
+// Sum over the 64 tiles of 2^popcount(mask)
+const int rookTableSize = 0x19000;
+const int bishopTableSize = 0x1480;
+
+uint64_t rookTable[rookTableSize];
+uint64_t bishopTable[bishopTableSize];
+
+bool initialized = false;
+
+const uint64_t rowMask = (1ull << 8) - 1;
+const uint64_t columnMask = 0x0101010101010101ull;
+
+/**
+ * @brief xorshift64* generator. Seeded with a constant so the magics, and
+ * therefore the startup time, are the same on every run.
+ */
+class Prng {
+public:
+	explicit Prng(uint64_t seed) : s(seed) {}
+
+	uint64_t rand() {
+		s ^= s >> 12;
+		s ^= s << 25;
+		s ^= s >> 27;
+		return s * 2685821657736338717ull;
+	}
+
+	// Magics with few bits set are found much faster
+	uint64_t sparseRand() { return rand() & rand() & rand(); }
+
+private:
+	uint64_t s;
+};
+
+void initSlider(bool isBishop, Magic *magics, uint64_t *table) {
+	uint64_t occupancy[4096], reference[4096];
+	int epoch[4096] = {}, attempt = 0;
+	Prng prng(isBishop ? 0x5A17B15Full : 0x7C1E5EEDull);
+	uint64_t *next = table;
+
+	for (int tile = 0; tile < 64; tile++) {
+		int row = tile >> 3;
+		int column = tile & 7;
+
+		// Pieces on the board edges never change the attack set
+		uint64_t edges = (((rowMask | (rowMask << 56)) & ~(rowMask << (row << 3))) |
+											(((columnMask | (columnMask << 7)) & ~(columnMask << column))));
+
+		Magic &m = magics[tile];
+		m.mask = slidingAttacksSlow(isBishop, tile, 0) & ~edges;
+		m.shift = 64 - __builtin_popcountll(m.mask);
+		m.attacks = next;
+
+		// Carry-Rippler enumeration of every subset of the mask
+		int size = 0;
+		uint64_t b = 0;
+		do {
+			occupancy[size] = b;
+			reference[size] = slidingAttacksSlow(isBishop, tile, b);
+#if defined(__BMI2__)
+			m.attacks[_pext_u64(b, m.mask)] = reference[size];
+#endif
+			size++;
+			b = (b - m.mask) & m.mask;
+		} while (b);
+		next += size;
+
+#if !defined(__BMI2__)
+		// Try random candidates until one maps every subset without a harmful
+		// collision (two occupancies sharing a slot must share the attack set)
+		for (int i = 0; i < size;) {
+			m.magic = 0;
+			while (__builtin_popcountll((m.mask * m.magic) >> 56) < 6) {
+				m.magic = prng.sparseRand();
+			}
+
+			for (++attempt, i = 0; i < size; i++) {
+				unsigned idx = m.index(occupancy[i]);
+				if (epoch[idx] < attempt) {
+					epoch[idx] = attempt;
+					m.attacks[idx] = reference[i];
+				} else if (m.attacks[idx] != reference[i]) {
+					break;
+				}
+			}
+		}
+#endif
+	}
+}
+
+/**
+ * @brief Bitboard of the squares reached from tile by the given (row, column)
+ * offsets, dropping those that fall off the board.
+ */
+uint64_t leaperAttacks(int tile, const int (*offsets)[2], int count) {
+	uint64_t attacks = 0;
+	for (int i = 0; i < count; i++) {
+		int row = (tile >> 3) + offsets[i][0];
+		int column = (tile & 7) + offsets[i][1];
+		if (row >= 0 && row < 8 && column >= 0 && column < 8) {
+			attacks |= 1ull << (row * 8 + column);
+		}
+	}
+	return attacks;
+}
+
+void initLeapersAndLines() {
+	const int knightOffsets[8][2] = {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2},
+																	 {1, -2},	 {1, 2},	{2, -1},	{2, 1}};
+	const int kingOffsets[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1},
+																 {0, 1},	 {1, -1},	{1, 0},	 {1, 1}};
+	// White pawns move towards row 0, black pawns towards row 7
+	const int pawnOffsets[2][2][2] = {{{-1, -1}, {-1, 1}}, {{1, -1}, {1, 1}}};
+
+	for (int tile = 0; tile < 64; tile++) {
+		knightAttacks[tile] = leaperAttacks(tile, knightOffsets, 8);
+		kingAttacks[tile] = leaperAttacks(tile, kingOffsets, 8);
+		pawnAttacks[0][tile] = leaperAttacks(tile, pawnOffsets[0], 2);
+		pawnAttacks[1][tile] = leaperAttacks(tile, pawnOffsets[1], 2);
+	}
+
+	for (int a = 0; a < 64; a++) {
+		for (int b = 0; b < 64; b++) {
+			between[a][b] = line[a][b] = 0;
+			if (a == b) {
+				continue;
+			}
+			uint64_t bBoard = 1ull << b;
+			for (int isBishop = 0; isBishop < 2; isBishop++) {
+				if (slidingAttacksSlow(isBishop, a, 0) & bBoard) {
+					line[a][b] = (slidingAttacksSlow(isBishop, a, 0) &
+												slidingAttacksSlow(isBishop, b, 0)) |
+											 (1ull << a) | bBoard;
+					between[a][b] = slidingAttacksSlow(isBishop, a, bBoard) &
+													slidingAttacksSlow(isBishop, b, 1ull << a);
+				}
+			}
+		}
+	}
+}
+
+} // namespace
+
+uint64_t slidingAttacksSlow(bool isBishop, int tile, uint64_t occupancy) {
+	const int rookDirections[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+	const int bishopDirections[4][2] = {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+	const int(&directions)[4][2] = isBishop ? bishopDirections : rookDirections;
+
+	uint64_t attacks = 0;
+	for (int d = 0; d < 4; d++) {
+		int row = (tile >> 3) + directions[d][0];
+		int column = (tile & 7) + directions[d][1];
+		while (row >= 0 && row < 8 && column >= 0 && column < 8) {
+			uint64_t square = 1ull << (row * 8 + column);
+			attacks |= square;
+			if (occupancy & square) {
+				break;
+			}
+			row += directions[d][0];
+			column += directions[d][1];
+		}
+	}
+	return attacks;
+}
+
+void init() {
+	if (initialized) {
+		return;
+	}
+	initSlider(false, rookMagics, rookTable);
+	initSlider(true, bishopMagics, bishopTable);
+	initLeapersAndLines();
+	initialized = true;
+}
+
+void setSliderMode(SliderMode mode) {
+	init();
+	sliderMode = mode;
+}
+
+SliderMode getSliderMode() { return sliderMode; }
+
+void setCheckMode(CheckMode mode) {
+	init();
+	checkMode = mode;
+}
+
+CheckMode getCheckMode() { return checkMode; }
+
+// Fill the tables before main() so lookups never have to check for it
+static const bool startupInit = (init(), true);
+
+} // namespace AttackTables
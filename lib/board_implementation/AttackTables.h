@@ -0,0 +1,133 @@
+#pragma once
+
+#ifdef _MSC_VER
+#include <immintrin.h>
+#include <nmmintrin.h>
+#define __builtin_popcountll _mm_popcnt_u64
+#define __builtin_ctzll _tzcnt_u64
+#define __builtin_clzll _lzcnt_u64
+#endif
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Precomputed slider attack tables for CFBoard.
+
+Every (tile, relevant occupancy) pair of a rook or a bishop is mapped to a
+slot of a flat attack table, either with a magic multiplication or, when the
+compiler targets BMI2, with a PEXT instruction. A slider attack is then a
+mask, an index computation and a single load.
+
+The module also holds the knight, king and pawn patterns and the
+between/line masks used by the bulk move generator.
+
+Tiles follow the CFBoard convention: 0 to 63 in the order (a8, b8, ..., h8,
+a7, ..., h7, ......, a1, ..., h1). The tables are filled once at program
+startup.
+
+*/
+
+namespace AttackTables {
+
+/**
+ * @brief Selects how CFBoard::getCardinals / CFBoard::getDiagonals compute
+ * slider attacks.
+ *
+ * CLASSIC is the original bit-twiddling code, LOOKUP the precomputed tables.
+ */
+enum class SliderMode { CLASSIC, LOOKUP };
+
+/**
+ * @brief Selects how CFBoard::naiveCheckCheck and CFBoard::getLegalMoves
+ * detect checks.
+ *
+ * CLASSIC walks the rays around the king square by square, once per candidate
+ * move. ATTACK_MAP looks the attackers up in the tables and filters all the
+ * candidates of a piece at once with check and pin masks.
+ */
+enum class CheckMode { CLASSIC, ATTACK_MAP };
+
+/**
+ * @brief Lookup data for one tile of one slider type.
+ */
+struct Magic {
+	uint64_t mask;		 // relevant occupancy (board edges excluded)
+	uint64_t magic;		 // magic multiplier (unused with PEXT)
+	uint64_t *attacks; // start of this tile's slice in the attack table
+	int shift;				 // 64 - popcount(mask)
+
+	unsigned index(uint64_t occupancy) const {
+#if defined(__BMI2__)
+		return static_cast<unsigned>(_pext_u64(occupancy, mask));
+#else
+		return static_cast<unsigned>(((occupancy & mask) * magic) >> shift);
+#endif
+	}
+};
+
+extern Magic rookMagics[64];
+extern Magic bishopMagics[64];
+extern SliderMode sliderMode;
+extern CheckMode checkMode;
+
+extern uint64_t knightAttacks[64];
+extern uint64_t kingAttacks[64];
+// pawnAttacks[color][tile]: squares a pawn of color (0 white, 1 black) on
+// tile captures on
+extern uint64_t pawnAttacks[2][64];
+// between[a][b]: squares strictly between a and b if they share a line, 0
+// otherwise
+extern uint64_t between[64][64];
+// line[a][b]: the whole rank, file or diagonal through a and b, 0 if they are
+// not aligned
+extern uint64_t line[64][64];
+
+/**
+ * @brief Fills the tables. Called automatically at startup; calling it again
+ * is a no-op.
+ */
+void init();
+
+/**
+ * @brief Changes the slider implementation used by CFBoard at runtime.
+ */
+void setSliderMode(SliderMode mode);
+SliderMode getSliderMode();
+
+/**
+ * @brief Changes the check detection used by CFBoard at runtime, e.g. to
+ * compare both implementations in tests.
+ */
+void setCheckMode(CheckMode mode);
+CheckMode getCheckMode();
+
+/**
+ * @brief Squares a rook on tile attacks, stopping at (and including) the
+ * first occupied square in each direction. Colors are not taken into account.
+ *
+ * @param tile : <int> from 0 to 63.
+ * @param occupancy : <uint64_t> bitboard of every piece on the board.
+ */
+inline uint64_t rookAttacks(int tile, uint64_t occupancy) {
+	const Magic &m = rookMagics[tile];
+	return m.attacks[m.index(occupancy)];
+}
+
+/**
+ * @brief Same as rookAttacks, for a bishop.
+ */
+inline uint64_t bishopAttacks(int tile, uint64_t occupancy) {
+	const Magic &m = bishopMagics[tile];
+	return m.attacks[m.index(occupancy)];
+}
+
+/**
+ * @brief Reference implementation walking the rays square by square. Used to
+ * fill the tables and by the equivalence tests.
+ */
+uint64_t slidingAttacksSlow(bool isBishop, int tile, uint64_t occupancy);
+
+} // namespace AttackTables
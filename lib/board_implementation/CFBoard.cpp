@@ -1,4 +1,6 @@
 #include "CFBoard.h"
+#include "AttackTables.h"
+#include "Zobrist.h"
 #include <bitset>
 #include <cctype>
 #include <iostream>
@@ -6,6 +8,11 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <type_traits>
+
+// Copying a board (including its undo stack) is a plain memcpy
+static_assert(std::is_trivially_copyable<CFBoard>::value,
+    "CFBoard must stay trivially copyable");
 
 
 /*
@@ -48,6 +55,9 @@ CFBoard::CFBoard() { // This is just the starter board.
     turn = 0;
     enPassantTarget = -1;
     castleCheck = 15;
+
+    hash = computeHash();
+    pawnHash = computePawnHash();
 }
 
 void CFBoard::fromFEN(std::string FEN) {
@@ -127,11 +137,15 @@ void CFBoard::fromFEN(std::string FEN) {
     // En passant
     std::string string_enpassant = fields[3];
     if (string_enpassant != "-") {
-        // 16 bits used for squares a6->h6, then a3->h3
+        // rows count down from the 8th rank
         int col = string_enpassant[0] - 'a';
-        int row = string_enpassant[1] - '1';
+        int row = '8' - string_enpassant[1];
         enPassantTarget = row * 8 + col;
     }
+
+    hash = computeHash();
+    pawnHash = computePawnHash();
+    verifyHash();
 }
 
 std::string CFBoard::toFEN() {
@@ -189,8 +203,8 @@ std::string CFBoard::toFEN() {
     } else {
         int row = enPassantTarget >> 3;
         int col = enPassantTarget & 7;
-        fenString.push_back(col + 'a');
-        fenString.push_back(row + '1');
+        fenString.push_back(static_cast<char>(col + 'a'));
+        fenString.push_back(static_cast<char>('8' - row));
     }
     // (optional: not that important)
     // 5. halfmove clock
@@ -249,7 +263,7 @@ std::string CFBoard::getReprLegalMove(int pieceId, int tile){
 *
 * @return P/N/B/R/Q/K depending on the piece, lowercase if black piece.
 */
-char CFBoard::pieceIdToChar(int pieceId) {
+char CFBoard::pieceIdToChar(int pieceId) const {
     char pieceChar = '.';
     bool color = pieceId & 1;
     pieceId = pieceId >> 1;
@@ -316,7 +330,7 @@ int CFBoard::pieceCharToId(char pieceChar) {
 // ----- Get functions -----
 
 
-uint64_t CFBoard::getColorBitBoard(bool color) {
+uint64_t CFBoard::getColorBitBoard(bool color) const {
     if (color) {
         return blackBoard;
     }
@@ -324,7 +338,7 @@ uint64_t CFBoard::getColorBitBoard(bool color) {
 }
 
 
-uint64_t CFBoard::getPieceColorBitBoard(int pieceId) {
+uint64_t CFBoard::getPieceColorBitBoard(int pieceId) const {
     return getPieceBoardFromIndex(pieceId >> 1) & getColorBitBoard(pieceId & 1);
 }
 
@@ -347,10 +361,28 @@ uint64_t &CFBoard::getPieceBoardFromIndex(int boardIndex) {
 }
 
 
-bool CFBoard::getCurrentPlayer() { return turn; }
+uint64_t CFBoard::getPieceBoardFromIndex(int boardIndex) const {
+    switch (boardIndex) {
+    case 0:
+        return pawnBoard;
+    case 1:
+        return knightBoard;
+    case 2:
+        return bishopBoard;
+    case 3:
+        return rookBoard;
+    case 4:
+        return queenBoard;
+    default:
+        return kingBoard;
+    }
+}
+
 
+bool CFBoard::getCurrentPlayer() const { return turn; }
 
-int CFBoard::getPieceFromCoords(int tile) {
+
+int CFBoard::getPieceFromCoords(int tile) const {
     for (int i = 0; i < 6; i++) {
         if ((getPieceBoardFromIndex(i) >> tile) & 1) {
             return (i << 1) | ((blackBoard >> tile) & 1);
@@ -360,7 +392,7 @@ int CFBoard::getPieceFromCoords(int tile) {
 }
 
 
-bool CFBoard::getBit(int pieceId, int tile) {
+bool CFBoard::getBit(int pieceId, int tile) const {
     return (getPieceColorBitBoard(pieceId) >> tile) & 1;
 }
 
@@ -378,6 +410,60 @@ bool CFBoard::isCurrentBoardLegal() {
 }
 
 
+/**
+* @brief Zobrist key of the castling rights and en passant file.
+*/
+static uint64_t castlingAndEnPassantKey(int castleCheck, int enPassantTarget) {
+    uint64_t key = Zobrist::keys.castling[castleCheck & 15];
+    if (enPassantTarget != -1) {
+        key ^= Zobrist::keys.enPassantFile[enPassantTarget & 7];
+    }
+    return key;
+}
+
+
+uint64_t CFBoard::computeHash() const {
+    const uint64_t pieceBoards[6] = {pawnBoard, knightBoard, bishopBoard, rookBoard, queenBoard, kingBoard};
+    uint64_t key = castlingAndEnPassantKey(castleCheck, enPassantTarget);
+    if (turn) {
+        key ^= Zobrist::keys.blackToMove;
+    }
+    for (int pieceType = 0; pieceType < 6; pieceType++) {
+        for (int color = 0; color < 2; color++) {
+            uint64_t board = pieceBoards[pieceType] & (color ? blackBoard : whiteBoard);
+            while (board) {
+                key ^= Zobrist::keys.piece[(pieceType << 1) | color][__builtin_ctzll(board)];
+                board &= board - 1;
+            }
+        }
+    }
+    return key;
+}
+
+
+uint64_t CFBoard::computePawnHash() const {
+    uint64_t key = 0;
+    for (int color = 0; color < 2; color++) {
+        uint64_t board = pawnBoard & (color ? blackBoard : whiteBoard);
+        while (board) {
+            key ^= Zobrist::keys.piece[color][__builtin_ctzll(board)];
+            board &= board - 1;
+        }
+    }
+    return key;
+}
+
+
+void CFBoard::verifyHash() {
+#ifdef CFBOARD_DEBUG_HASH
+    if (hash != computeHash() || pawnHash != computePawnHash()) {
+        std::cerr << "hash mismatch on " << toFEN() << std::endl;
+        exit(-1);
+    }
+#endif
+}
+
+
 std::string CFBoard::tileToCoords(int tile){
     std::string ret = "";
     
@@ -429,6 +515,11 @@ void CFBoard::addPiece(int pieceId, int tile) {
     int pieceType = pieceId >> 1;
     bool color = pieceId & 1;
 
+    hash ^= Zobrist::keys.piece[pieceId][tile];
+    if (pieceType == 0) {
+        pawnHash ^= Zobrist::keys.piece[pieceId][tile];
+    }
+
     uint64_t &targetBoard = getPieceBoardFromIndex(pieceType);
     targetBoard = targetBoard | pieceBoard;
 
@@ -441,6 +532,15 @@ void CFBoard::addPiece(int pieceId, int tile) {
 
 
 void CFBoard::removePiece(int tile) {
+    int pieceId = getPieceFromCoords(tile);
+    if (pieceId == -1) {
+        return;
+    }
+    hash ^= Zobrist::keys.piece[pieceId][tile];
+    if ((pieceId >> 1) == 0) {
+        pawnHash ^= Zobrist::keys.piece[pieceId][tile];
+    }
+
     uint64_t antiPieceBoard = ~(1ll << tile);
     for (int pieceType = 0; pieceType < 6; pieceType++) {
         uint64_t &targetBoard = getPieceBoardFromIndex(pieceType);
@@ -480,6 +580,7 @@ void CFBoard::forceMovePiece(int startTile, int endTile, int pawnPromotionType)
 
 	//make a backup of our state
 	backupState();
+	uint64_t oldStateKey = castlingAndEnPassantKey(castleCheck, enPassantTarget);
 
 
 	removePiece(startTile);
@@ -532,75 +633,54 @@ void CFBoard::forceMovePiece(int startTile, int endTile, int pawnPromotionType)
 	}
 
 
-	if (~turn) { // white
-		if ((piece >> 1) == 3) { // rook
-			if (startTile == 63) {
-				castleCheck &= ~1;
-			}
-			else if (startTile == 56) {
-				castleCheck &= ~2;
-			}
-		}
-		if ((piece >> 1) == 5) { // king
-			castleCheck &= ~3;
-		}
+	// en passant capture: the captured pawn is behind the target tile
+	if ((piece >> 1) == 0 && endTile == enPassantTarget && (startTile & 7) != (endTile & 7)) {
+		removePiece((piece & 1) ? endTile - 8 : endTile + 8);
+	}
 
-		if ((piece >> 1) == 0) { // pawn
-			if ((startTile - endTile) == 16) {
-				enPassantTarget = startTile - 8;
-			}
-		}
+	// the target only lasts for the move right after the double push
+	enPassantTarget = -1;
+	if ((piece >> 1) == 0 && abs(startTile - endTile) == 16) {
+		enPassantTarget = (startTile + endTile) / 2;
 	}
-	else {
-		if ((piece >> 1) == 3) { // rook
-			if (startTile == 0) {
-				castleCheck &= ~8;
-			}
-			else if (startTile == 7) {
-				castleCheck &= ~4;
-			}
-		}
-		if ((piece >> 1) == 5) { // king
-			castleCheck &= ~12;
-		}
 
-		if ((piece >> 1) == 0) { // pawn
-			if ((endTile - startTile) == 16) {
-				enPassantTarget = startTile + 8;
-			}
+	if ((piece >> 1) == 5) { // king
+		castleCheck &= (piece & 1) ? ~12 : ~3;
+	}
+
+	// moving a rook away or capturing it on its corner loses that side
+	const int rookCorners[4] = {63, 56, 7, 0}; // same order as the castleCheck bits
+	for (int i = 0; i < 4; i++) {
+		if (startTile == rookCorners[i] || endTile == rookCorners[i]) {
+			castleCheck &= ~(1 << i);
 		}
 	}
 
 	if ((piece >> 1 == 5) && (abs(startTile - endTile) == 2)) {
-		int castle;
-		if (piece & 1) {
-			castle = castleCheck >> 2;
-		}
-		else {
-			castle = castleCheck & 3;
-		}
-		castleCheck = castleCheck & ~castle;
-		if (abs(startTile - endTile) == 2) {
+		if (endTile < startTile) { // long
 			removePiece(startTile - 4);
 			addPiece(6 + (piece & 1), startTile - 1);
 		}
-		else {
+		else { // short
 			removePiece(startTile + 3);
 			addPiece(6 + (piece & 1), startTile + 1);
 		}
-
 	}
 
 	turn = !turn;
+	hash ^= Zobrist::keys.blackToMove ^ oldStateKey ^ castlingAndEnPassantKey(castleCheck, enPassantTarget);
 
 
 	//from now on, our state is illegitimate
 	isStateLegal = false;
+	verifyHash();
 
 }
 
 void CFBoard::forceFlipTurn() {
     turn = !turn;
+    hash ^= Zobrist::keys.blackToMove;
+    verifyHash();
 }
 
 void CFBoard::undoLastMove() {
@@ -608,50 +688,29 @@ void CFBoard::undoLastMove() {
 		exit(-1);
 	}
 
-
-	//if so, set our state
-	// std::cout << pawnBoard << std::endl;
-	// std::cout << pawnBoardBackups[0] << std::endl;
-
-	pawnBoard = pawnBoardBackups[0];
-	knightBoard = knightBoardBackups[0] ;
-	bishopBoard = bishopBoardBackups[0];
-	rookBoard = rookBoardBackups[0];
-	queenBoard = queenBoardBackups[0] ;
-	kingBoard  = kingBoardBackups[0];
-
-	blackBoard = blackBoardBackups[0];
-	whiteBoard = whiteBoardBackups[0];
-
-	enPassantTarget = enPassantTargetBackups[0];
-	castleCheck = castleCheckBackups[0];
-	isStateLegal = isStateLegalBackups[0];
-
-	turn = 1-turn;
-
-
-
-	//update and remove the backup we just reverted to
+	//if so, pop the most recent backup and set our state
+	backupTop = (backupTop - 1) & (backupCount - 1);
 	backupStock--;
-
-	for (int i = 0; i <= backupCount - 2; i++) {
-		pawnBoardBackups[i] = pawnBoardBackups[i + 1];
-		knightBoardBackups[i] = knightBoardBackups[i + 1];
-		bishopBoardBackups[i] = bishopBoardBackups[i + 1];
-		rookBoardBackups[i] = rookBoardBackups[i + 1];
-		queenBoardBackups[i] = queenBoardBackups[i + 1];
-		kingBoardBackups[i] = kingBoardBackups[i + 1];
-
-		blackBoardBackups[i] = blackBoardBackups[i + 1];
-		whiteBoardBackups[i] = whiteBoardBackups[i + 1];
-
-		enPassantTargetBackups[i] = enPassantTargetBackups[i + 1];
-		castleCheckBackups[i] = castleCheckBackups[i + 1];
-		isStateLegalBackups[i] = isStateLegalBackups[i + 1];
-
-
-	}
-
+	const StateBackup &backup = backups[backupTop];
+
+	pawnBoard = backup.pawnBoard;
+	knightBoard = backup.knightBoard;
+	bishopBoard = backup.bishopBoard;
+	rookBoard = backup.rookBoard;
+	queenBoard = backup.queenBoard;
+	kingBoard = backup.kingBoard;
+
+	blackBoard = backup.blackBoard;
+	whiteBoard = backup.whiteBoard;
+
+	enPassantTarget = backup.enPassantTarget;
+	castleCheck = backup.castleCheck;
+	turn = backup.turn;
+	isStateLegal = backup.isStateLegal;
+
+	hash = backup.hash;
+	pawnHash = backup.pawnHash;
+	verifyHash();
 }
 
 void CFBoard::forceAddPiece(int pieceId, int tile) {
@@ -660,6 +719,7 @@ void CFBoard::forceAddPiece(int pieceId, int tile) {
 
 	isStateLegal = false;
 	addPiece(pieceId, tile);
+	verifyHash();
 }
 
 
@@ -668,12 +728,29 @@ void CFBoard::forceRemovePiece(int tile) {
 
 	isStateLegal = false;
 	removePiece(tile);
+	verifyHash();
 }
 
 // ----- Ruleset -----
 
 
 uint64_t CFBoard::getCardinals(int tile, bool color) {
+    if (AttackTables::sliderMode == AttackTables::SliderMode::LOOKUP) {
+        return AttackTables::rookAttacks(tile, whiteBoard | blackBoard) & ~getColorBitBoard(color);
+    }
+    return getCardinalsClassic(tile, color);
+}
+
+
+uint64_t CFBoard::getDiagonals(int tile, bool color) {
+    if (AttackTables::sliderMode == AttackTables::SliderMode::LOOKUP) {
+        return AttackTables::bishopAttacks(tile, whiteBoard | blackBoard) & ~getColorBitBoard(color);
+    }
+    return getDiagonalsClassic(tile, color);
+}
+
+
+uint64_t CFBoard::getCardinalsClassic(int tile, bool color) {
     //int column = tile & 7;
     //int row = tile >> 3;
 
@@ -686,8 +763,9 @@ uint64_t CFBoard::getCardinals(int tile, bool color) {
     // most significant bit: (1ll << (63 - __builtin_clzll(b)))
     
     // up | left | right | down
+    // (on the 8th rank "up" is empty: shifting columnMap by 64 would be undefined)
     return (\
-    (~((1ll << (63 - __builtin_clzll( ((1ll<<tile)-1) & allBoard & columnMap ))) - 1)) & (columnMap >> (64 - (tile>>3<<3))) | \
+    ((~((1ll << (63 - __builtin_clzll( ((1ll<<tile)-1) & allBoard & columnMap ))) - 1)) & ((tile >> 3) ? (columnMap >> (64 - (tile>>3<<3))) : 0)) | \
     (~((1ll << (63 - __builtin_clzll( ((1ll<<tile)-1) & allBoard))) - 1)) & (rowMap & ((1ll<<tile)-1)) | \
     (tile != 63)*((((allBoard & ~((1ll << (tile+1))-1)) & (1+(~(allBoard & ~((1ll << (tile+1))-1))))) << 1) -1 \
     & (rowMap & ~((1ll << (tile+1))-1))) | (tile != 63)*\
@@ -696,7 +774,7 @@ uint64_t CFBoard::getCardinals(int tile, bool color) {
 }
 
 
-uint64_t CFBoard::getDiagonals(int tile, bool color) {
+uint64_t CFBoard::getDiagonalsClassic(int tile, bool color) {
     int column = tile & 7;
     int row = tile >> 3;
     uint64_t allBoard = whiteBoard | blackBoard;
@@ -764,7 +842,7 @@ uint64_t CFBoard::getKingPattern(int tile, bool color) {
     (1ll << (tile - 7))*(column < 7 && row > 0) | \
     (1ll << (tile + 9))*(column < 7 && row < 7)) & (~allyBoard);
 
-    if (tile!=60 && tile!=4){
+    if (tile != (color ? 4 : 60)){
         return kingPattern;
     }
 
@@ -779,12 +857,13 @@ uint64_t CFBoard::getKingPattern(int tile, bool color) {
     // WARNING: this makes a handful of assumptions.
     // If you customized the whole board into an illegal position, this part may crash the code.
     uint64_t board = whiteBoard | blackBoard;
-    if (castle>>1){ //long
-        bool longsideoccupied = ((board << (tile - 1)) & 1) | ((board << (tile - 2)) & 1) | ((board << (tile - 3)) & 1);
+    uint64_t allyRooks = rookBoard & allyBoard;
+    if ((castle>>1) && ((allyRooks >> (tile - 4)) & 1)){ //long
+        bool longsideoccupied = ((board >> (tile - 1)) & 1) | ((board >> (tile - 2)) & 1) | ((board >> (tile - 3)) & 1);
         if (!longsideoccupied){kingPattern += (1ll << (tile-2));}
     }
-    if (castle&1){ //short
-        bool shortsideoccupied = ((board << (tile + 1)) & 1) | ((board << (tile + 2)) & 1);
+    if ((castle&1) && ((allyRooks >> (tile + 3)) & 1)){ //short
+        bool shortsideoccupied = ((board >> (tile + 1)) & 1) | ((board >> (tile + 2)) & 1);
         if (!shortsideoccupied){kingPattern += (1ll << (tile+2));}
     }
 
@@ -813,13 +892,13 @@ uint64_t CFBoard::getPawnPattern(int tile, bool color) {
             }
             // diagonals
             if (column > 0) {
-                if ((enPassantTarget == tile + 7) ||
+                if ((enPassantTarget == tile + 7 && (enPassantTarget >> 3) == 5) ||
                     (enemyBoard >> (tile + 7) & 1)) {
                     pawnPattern += (1ll << (tile + 7));
                 }
             }
             if (column < 7) {
-                if ((enPassantTarget == tile + 9) ||
+                if ((enPassantTarget == tile + 9 && (enPassantTarget >> 3) == 5) ||
                     (enemyBoard >> (tile + 9) & 1)) {
                     pawnPattern += (1ll << (tile + 9));
                 }
@@ -840,13 +919,13 @@ uint64_t CFBoard::getPawnPattern(int tile, bool color) {
             }
             // diagonals
             if (column > 0) {
-                if ((enPassantTarget == tile - 9) ||
+                if ((enPassantTarget == tile - 9 && (enPassantTarget >> 3) == 2) ||
                     (enemyBoard >> (tile - 9) & 1)) {
                     pawnPattern += (1ll << (tile - 9));
                 }
             }
             if (column < 7) {
-                if ((enPassantTarget == tile - 7) ||
+                if ((enPassantTarget == tile - 7 && (enPassantTarget >> 3) == 2) ||
                     (enemyBoard >> (tile - 7) & 1)) {
                     pawnPattern += (1ll << (tile - 7));
                 }
@@ -885,7 +964,18 @@ uint64_t CFBoard::getLegalMoves(int pieceId, int tile) {
 
     }
 
+    if (AttackTables::checkMode == AttackTables::CheckMode::ATTACK_MAP) {
+        return filterLegalMoves(pieceId, tile, retBoard);
+    }
+
+    // an en passant capture also empties the tile of the captured pawn, so it
+    // is checked separately below
+    bool isEnPassant = (pieceId >> 1) == 0 && enPassantTarget != -1 && ((retBoard >> enPassantTarget) & 1) && (tile & 7) != (enPassantTarget & 7);
+
     uint64_t tmpBoard = retBoard;
+    if (isEnPassant) {
+        tmpBoard &= ~(1ll << enPassantTarget);
+    }
     while (tmpBoard) {
         uint64_t lsb = tmpBoard & -tmpBoard;
         tmpBoard ^= lsb;
@@ -894,62 +984,57 @@ uint64_t CFBoard::getLegalMoves(int pieceId, int tile) {
             retBoard ^= lsb;
         }
     }
+
+    if ((pieceId >> 1) == 5 && (retBoard & ((1ll << (tile + 2)) | (1ll << (tile - 2))))) {
+        // castling is not allowed out of check or through an attacked tile
+        for (int side = -1; side <= 1; side += 2) {
+            if (((retBoard >> (tile + 2 * side)) & 1) && (naiveCheckCheck(color) || naiveCheckCheck(color, tile, tile + side))) {
+                retBoard &= ~(1ll << (tile + 2 * side));
+            }
+        }
+    }
+
+    if (isEnPassant) {
+        // redo the check without the captured pawn, which may have been giving
+        // check or blocking a slider along the row
+        uint64_t capturedPawn = 1ll << (color ? enPassantTarget - 8 : enPassantTarget + 8);
+        uint64_t &enemyBoard = color ? whiteBoard : blackBoard;
+        pawnBoard ^= capturedPawn;
+        enemyBoard ^= capturedPawn;
+        if (naiveCheckCheck(color, tile, enPassantTarget)) {
+            retBoard &= ~(1ll << enPassantTarget);
+        }
+        pawnBoard ^= capturedPawn;
+        enemyBoard ^= capturedPawn;
+    }
     return retBoard;
 }
 
 
 void CFBoard::backupState() {
-	//if this is our first backup, initialize the arrays
-	if (backupStock == 0) {
-		pawnBoardBackups = new uint64_t[backupCount];
-		knightBoardBackups = new uint64_t[backupCount];
-		bishopBoardBackups = new uint64_t[backupCount];
-		rookBoardBackups = new uint64_t[backupCount];
-		queenBoardBackups = new uint64_t[backupCount];
-		kingBoardBackups = new uint64_t[backupCount];
-
-		blackBoardBackups = new uint64_t[backupCount];
-		whiteBoardBackups = new uint64_t[backupCount];
-
-		enPassantTargetBackups = new int[backupCount];
-		castleCheckBackups = new int[backupCount];
-		isStateLegalBackups = new bool[backupCount];
-	}
-	else { //roll all backups forward
-		for (int i = backupCount - 1; i >= 1; i--) {
-			pawnBoardBackups[i] = pawnBoardBackups[i - 1];
-			knightBoardBackups[i] = knightBoardBackups[i - 1];
-			bishopBoardBackups[i] = bishopBoardBackups[i - 1];
-			rookBoardBackups[i] = rookBoardBackups[i - 1];
-			queenBoardBackups[i] = queenBoardBackups[i - 1];
-			kingBoardBackups[i] = kingBoardBackups[i - 1];
-
-			blackBoardBackups[i] = blackBoardBackups[i - 1];
-			whiteBoardBackups[i] = whiteBoardBackups[i - 1];
-
-			enPassantTargetBackups[i] = enPassantTargetBackups[i - 1];
-			castleCheckBackups[i] = castleCheckBackups[i-1];
-			isStateLegalBackups[i] = isStateLegalBackups[i-1];
-
-
-		}
+	//write the current state on top of the ring, overwriting the oldest backup when full
+	StateBackup &backup = backups[backupTop];
+
+	backup.pawnBoard = pawnBoard;
+	backup.knightBoard = knightBoard;
+	backup.bishopBoard = bishopBoard;
+	backup.rookBoard = rookBoard;
+	backup.queenBoard = queenBoard;
+	backup.kingBoard = kingBoard;
+
+	backup.blackBoard = blackBoard;
+	backup.whiteBoard = whiteBoard;
+
+	backup.enPassantTarget = static_cast<int8_t>(enPassantTarget);
+	backup.castleCheck = static_cast<uint8_t>(castleCheck);
+	backup.turn = turn;
+	backup.isStateLegal = isStateLegal;
+
+	backup.hash = hash;
+	backup.pawnHash = pawnHash;
+
+	backupTop = (backupTop + 1) & (backupCount - 1);
+	if (backupStock < backupCount) {
+		backupStock++;
 	}
-
-	//now save the current state at the first index
-	pawnBoardBackups[0] = pawnBoard;
-	knightBoardBackups[0] = knightBoard;
-	bishopBoardBackups[0] = bishopBoard;
-	rookBoardBackups[0] = rookBoard;
-	queenBoardBackups[0] = queenBoard;
-	kingBoardBackups[0] = kingBoard;
-
-	blackBoardBackups[0] = blackBoard;
-	whiteBoardBackups[0] = whiteBoard;
-
-	enPassantTargetBackups[0] = enPassantTarget;
-	castleCheckBackups[0] = castleCheck;
-	isStateLegalBackups[0] = isStateLegal;
-
-	//increase the backup stock
-	backupStock++;
 }
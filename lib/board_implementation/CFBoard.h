@@ -7,9 +7,16 @@
 #define __builtin_ctzll _tzcnt_u64
 #define __builtin_clzll _lzcnt_u64
 #endif
+#include "MoveList.h"
 #include <iostream>
 #include <stdint.h>
 
+// Number of moves that can be undone in a row. Every CFBoard stores its
+// backups inline, so this directly sets sizeof(CFBoard).
+#ifndef CFBOARD_BACKUP_DEPTH
+#define CFBOARD_BACKUP_DEPTH 256
+#endif
+
 
 class CFBoard {
 public:
@@ -27,7 +34,10 @@ public:
 		bishopBoard(bishopBoard), rookBoard(rookBoard),
 		queenBoard(queenBoard), kingBoard(kingBoard),
 		enPassantTarget(enPassantTarget), castleCheck(castleCheck),
-		blackBoard(blackBoard), whiteBoard(whiteBoard), turn(turn) {}
+		blackBoard(blackBoard), whiteBoard(whiteBoard), turn(turn) {
+		hash = computeHash();
+		pawnHash = computePawnHash();
+	}
 
 	void fromFEN(std::string FEN); // TO DO
 	std::string toFEN();
@@ -48,7 +58,7 @@ public:
 	*
 	* @return P/N/B/R/Q/K depending on the piece, lowercase if black piece.
 	*/
-	char pieceIdToChar(int pieceId);
+	char pieceIdToChar(int pieceId) const;
 
 	/**
 	* @brief This function takes a pieceId and returns the associated
@@ -75,7 +85,7 @@ public:
 	*
 	* @return <uint64_t> copy of stored attribute for all pieces of a color.
 	*/
-	uint64_t getColorBitBoard(bool color);
+	uint64_t getColorBitBoard(bool color) const;
 
 
 	/**
@@ -87,7 +97,7 @@ public:
 	* @return <uint64_t> bitboard for the specified piece (color taken into
 	* account).
 	*/
-	uint64_t getPieceColorBitBoard(int pieceId);
+	uint64_t getPieceColorBitBoard(int pieceId) const;
 
 
 	/**
@@ -100,6 +110,7 @@ public:
 	* @return <uint64_t &> reference to private attribute bitboard.
 	*/
 	uint64_t& getPieceBoardFromIndex(int boardIndex);
+	uint64_t getPieceBoardFromIndex(int boardIndex) const;
 
 
 	/**
@@ -107,7 +118,22 @@ public:
 	*
 	* @return Material count for that color.
 	*/
-	bool getCurrentPlayer();
+	bool getCurrentPlayer() const;
+
+
+	/**
+	* @brief Returns the tile a pawn can capture en passant on.
+	*
+	* @return <int> from 0 to 63, -1 if no en passant capture is possible.
+	*/
+	int getEnPassantTarget() const { return enPassantTarget; }
+
+
+	/**
+	* @brief Returns the castling rights, in the order of FEN: bit 0 for K,
+	* 1 for Q, 2 for k, 3 for q.
+	*/
+	int getCastlingRights() const { return castleCheck & 15; }
 
 
 	/**
@@ -119,7 +145,7 @@ public:
 	* @return <int> equal to 0/2/4/6/8/10 for P/N/B/R/Q/K, +1 if the piece is
 	* black.
 	*/
-	int getPieceFromCoords(int tile);
+	int getPieceFromCoords(int tile) const;
 
 
 	/**
@@ -133,7 +159,7 @@ public:
 	*
 	* @return <bool> 1 if the piece is on that tile, 0 otherwise.
 	*/
-	bool getBit(int pieceId, int tile);
+	bool getBit(int pieceId, int tile) const;
 
 
 	/**
@@ -145,6 +171,25 @@ public:
 	*/
 	int getMaterialCount(bool color);
 
+	/**
+	* @brief Returns the 64-bit Zobrist key of the position (pieces, side to
+	* move, castling rights and en passant file). It is updated incrementally
+	* by every board manipulation and restored by undoLastMove.
+	*/
+	uint64_t getHash() const { return hash; }
+
+	/**
+	* @brief Returns the Zobrist key of the pawns of both colors only.
+	*/
+	uint64_t getPawnHash() const { return pawnHash; }
+
+	/**
+	* @brief Computes getHash() / getPawnHash() from scratch. Slow, used to
+	* verify the incremental keys.
+	*/
+	uint64_t computeHash() const;
+	uint64_t computePawnHash() const;
+
 	/**
 	* @brief As soon as a forced move is performed, we return false even if the current board could be legal. Basically a check of whether the current board was only reached using fully legal moves.
 
@@ -202,6 +247,16 @@ public:
 	*/
 	void forceMovePiece(int starttile, int endtile, int pawnPromotionType = -1);
 
+	/**
+	* @brief Plays a move produced by generateMoves. Same as movePiece without
+	* the legality check, since generated moves are always legal.
+	*
+	* @param move : 16-bit packed move (see MoveList.h).
+	*
+	* @return void.
+	*/
+	void makeMove(uint16_t move);
+
 	/**
 	* @brief Force flipping turn for one-person dfs.
 	*
@@ -211,7 +266,9 @@ public:
 
 
 	/**
-	* @brief Undoes the last move exactly using our state backup (can only be done 4 times in a row max currently)
+	* @brief Undoes the last movePiece, forceMovePiece, forceAddPiece or
+	* forceRemovePiece exactly using our state backup, including whose turn it
+	* was. Up to CFBOARD_BACKUP_DEPTH operations can be undone in a row.
 	*
 	* @return void.
 	*/
@@ -255,6 +312,16 @@ public:
 	uint64_t getDiagonals(int tile, bool color);
 
 
+	/**
+	* @brief Original bit-twiddling implementations of getCardinals and
+	* getDiagonals. getCardinals / getDiagonals use them when
+	* AttackTables::setSliderMode(AttackTables::SliderMode::CLASSIC) was
+	* called, and the tests compare both implementations.
+	*/
+	uint64_t getCardinalsClassic(int tile, bool color);
+	uint64_t getDiagonalsClassic(int tile, bool color);
+
+
 	/**
 	* @brief This function returns the naive move pattern for a knight.
 	*
@@ -307,6 +374,43 @@ public:
 
 
 
+	/**
+	* @brief Fills moveList with every legal move of the player whose turn it
+	* is. Pieces are read from the bitboards directly and the check and pin
+	* masks are computed once, so this is much faster than calling
+	* getLegalMoves on every tile. Pawns reaching the last row produce one
+	* move per promotion piece.
+	*
+	* @param moveList : <MoveList &> cleared, then filled with packed moves.
+	*
+	* @return void.
+	*/
+	void generateMoves(MoveList &moveList);
+
+
+	/**
+	* @brief Bitboard of the pieces of both colors attacking tile, with
+	* occupancy used to block the sliders.
+	*/
+	uint64_t attackersTo(int tile, uint64_t occupancy) const;
+
+
+	/**
+	* @brief Pieces of color that are the only piece between their king (on
+	* kingTile) and an enemy slider, and can therefore only move along that line.
+	*/
+	uint64_t pinnedPieces(bool color, int kingTile) const;
+
+
+	/**
+	* @brief Bitboard of every tile attacked by the pieces of a color, with
+	* occupancy used to block the sliders.
+	*
+	* @param color : 1 for black, 0 for white.
+	*/
+	uint64_t attackedTiles(bool color, uint64_t occupancy) const;
+
+
 	/**
 	 * @brief Checks if the current king is being checked by the opponent or not
 	 *
@@ -319,6 +423,14 @@ public:
 	 */
 	bool naiveCheckCheck(bool color, int coordA = -1, int coordB = -1);
 
+	/**
+	 * @brief Original ray-walking implementation of naiveCheckCheck. Used
+	 * instead of the attack tables when
+	 * AttackTables::setCheckMode(AttackTables::CheckMode::CLASSIC) was called,
+	 * and by the tests to compare both implementations.
+	 */
+	bool naiveCheckCheckClassic(bool color, int coordA = -1, int coordB = -1);
+
 	// Misc
 
 	friend bool operator==(const CFBoard& board1, const CFBoard& board2) {
@@ -357,26 +469,46 @@ private:
 	bool turn; // 0 for white, 1 for black
 	bool isStateLegal = true;//tells us whether the current state is legal i.e. no forced manipulations were done
 
+	uint64_t hash = 0; // Zobrist key of the whole position
+	uint64_t pawnHash = 0; // Zobrist key of the pawns only
 
 
-	//--------THE BACKUP OF VALUES FROM PREVIOUS STATES
-	const static int backupCount = 4;
-	int backupStock = 0; //how many backups we have in stock
-
-	uint64_t* pawnBoardBackups;
-	uint64_t* knightBoardBackups;
-	uint64_t* bishopBoardBackups;
-	uint64_t* rookBoardBackups;
-	uint64_t* queenBoardBackups;
-	uint64_t* kingBoardBackups;
-
-	uint64_t* blackBoardBackups;
-	uint64_t* whiteBoardBackups;
 
-	int* enPassantTargetBackups; 
-	int* castleCheckBackups; 
+	//--------THE BACKUP OF VALUES FROM PREVIOUS STATES
 
-	bool* isStateLegalBackups; //cursed data type : please fix if you're reading this
+	/**
+	* @brief Everything needed to restore a previous state, packed together so
+	* that a backup is a single struct copy.
+	*/
+	struct StateBackup {
+		uint64_t pawnBoard;
+		uint64_t knightBoard;
+		uint64_t bishopBoard;
+		uint64_t rookBoard;
+		uint64_t queenBoard;
+		uint64_t kingBoard;
+
+		uint64_t blackBoard;
+		uint64_t whiteBoard;
+
+		uint64_t hash;
+		uint64_t pawnHash;
+
+		int8_t enPassantTarget;
+		uint8_t castleCheck;
+		bool turn;
+		bool isStateLegal;
+	};
+
+	// Ring of the last backupCount states: pushing past the capacity silently
+	// drops the oldest backup.
+	const static int backupCount = CFBOARD_BACKUP_DEPTH;
+	static_assert((backupCount & (backupCount - 1)) == 0,
+		"CFBOARD_BACKUP_DEPTH must be a power of two");
+
+	StateBackup backups[backupCount];
+	int backupTop = 0; //index of the slot the next backup is written to
+	int backupStock = 0; //how many backups we have in stock
 
 	/**
 	* @brief This function places a piece on a given tile. It will replace any
@@ -407,4 +539,24 @@ private:
 	* @return void
 	*/
 	void backupState();
+
+	/**
+	* @brief Whether the pawn of color on startTile can capture en passant
+	* without leaving its king (on kingTile) in check.
+	*/
+	bool isEnPassantLegal(bool color, int kingTile, int startTile) const;
+
+	/**
+	* @brief Removes from moves (the naive pattern of the piece at tile) the
+	* destinations that would leave the king in check, using check and pin
+	* masks. Used by getLegalMoves in AttackTables::CheckMode::ATTACK_MAP.
+	*/
+	uint64_t filterLegalMoves(int pieceId, int tile, uint64_t moves) const;
+
+	/**
+	* @brief Compares the incremental keys with a full recompute and aborts on a
+	* mismatch. Does nothing unless CFBOARD_DEBUG_HASH is defined (see the
+	* ENABLE_HASH_CHECKS CMake option).
+	*/
+	void verifyHash();
 };
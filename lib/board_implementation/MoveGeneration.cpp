@@ -0,0 +1,302 @@
+#include "AttackTables.h"
+#include "CFBoard.h"
+
+using namespace AttackTables;
+
+namespace {
+
+/**
+ * @brief Pushes every move from startTile to the tiles of targets.
+ */
+inline void pushMoves(MoveList &moveList, int startTile, uint64_t targets) {
+	while (targets) {
+		moveList.push(CFMove::make(startTile, __builtin_ctzll(targets)));
+		targets &= targets - 1;
+	}
+}
+
+/**
+ * @brief Pushes one pawn move, expanded into the four promotions when the pawn
+ * reaches the last row.
+ */
+inline void pushPawnMove(MoveList &moveList, int startTile, int endTile) {
+	if (endTile <= 7 || endTile >= 56) {
+		for (int promotionType = 4; promotionType >= 1; promotionType--) {
+			moveList.push(CFMove::make(startTile, endTile, CFMove::PROMOTION,
+																 promotionType));
+		}
+	} else {
+		moveList.push(CFMove::make(startTile, endTile));
+	}
+}
+
+} // namespace
+
+uint64_t CFBoard::attackersTo(int tile, uint64_t occupancy) const {
+	return (pawnAttacks[0][tile] & pawnBoard & blackBoard) |
+				 (pawnAttacks[1][tile] & pawnBoard & whiteBoard) |
+				 (knightAttacks[tile] & knightBoard) |
+				 (kingAttacks[tile] & kingBoard) |
+				 (rookAttacks(tile, occupancy) & (rookBoard | queenBoard)) |
+				 (bishopAttacks(tile, occupancy) & (bishopBoard | queenBoard));
+}
+
+uint64_t CFBoard::attackedTiles(bool color, uint64_t occupancy) const {
+	uint64_t colorBoard = color ? blackBoard : whiteBoard;
+	uint64_t attacked = 0;
+
+	uint64_t pawns = pawnBoard & colorBoard;
+	while (pawns) {
+		attacked |= pawnAttacks[color][__builtin_ctzll(pawns)];
+		pawns &= pawns - 1;
+	}
+	uint64_t knights = knightBoard & colorBoard;
+	while (knights) {
+		attacked |= knightAttacks[__builtin_ctzll(knights)];
+		knights &= knights - 1;
+	}
+	uint64_t diagonalSliders = (bishopBoard | queenBoard) & colorBoard;
+	while (diagonalSliders) {
+		attacked |= bishopAttacks(__builtin_ctzll(diagonalSliders), occupancy);
+		diagonalSliders &= diagonalSliders - 1;
+	}
+	uint64_t cardinalSliders = (rookBoard | queenBoard) & colorBoard;
+	while (cardinalSliders) {
+		attacked |= rookAttacks(__builtin_ctzll(cardinalSliders), occupancy);
+		cardinalSliders &= cardinalSliders - 1;
+	}
+	uint64_t kings = kingBoard & colorBoard;
+	while (kings) {
+		attacked |= kingAttacks[__builtin_ctzll(kings)];
+		kings &= kings - 1;
+	}
+	return attacked;
+}
+
+uint64_t CFBoard::pinnedPieces(bool color, int kingTile) const {
+	uint64_t allyBoard = color ? blackBoard : whiteBoard;
+	uint64_t enemyBoard = color ? whiteBoard : blackBoard;
+	uint64_t allBoard = whiteBoard | blackBoard;
+
+	uint64_t snipers = ((rookAttacks(kingTile, 0) & (rookBoard | queenBoard)) |
+											(bishopAttacks(kingTile, 0) & (bishopBoard | queenBoard))) &
+										 enemyBoard;
+	uint64_t pinned = 0;
+	while (snipers) {
+		int sniperTile = __builtin_ctzll(snipers);
+		snipers &= snipers - 1;
+		uint64_t blockers = between[kingTile][sniperTile] & allBoard;
+		if ((blockers & (blockers - 1)) == 0) {
+			pinned |= blockers & allyBoard;
+		}
+	}
+	return pinned;
+}
+
+bool CFBoard::isEnPassantLegal(bool color, int kingTile, int startTile) const {
+	uint64_t enemyBoard = color ? whiteBoard : blackBoard;
+	uint64_t capturedPawn = 1ull << (color ? enPassantTarget - 8 : enPassantTarget + 8);
+	uint64_t occupancy = ((whiteBoard | blackBoard) ^ (1ull << startTile) ^
+												capturedPawn) |
+											 (1ull << enPassantTarget);
+	return !(attackersTo(kingTile, occupancy) & enemyBoard & ~capturedPawn);
+}
+
+uint64_t CFBoard::filterLegalMoves(int pieceId, int tile, uint64_t moves) const {
+	bool color = pieceId & 1;
+	uint64_t allyBoard = color ? blackBoard : whiteBoard;
+	uint64_t enemyBoard = color ? whiteBoard : blackBoard;
+	uint64_t allBoard = whiteBoard | blackBoard;
+	uint64_t allyKing = kingBoard & allyBoard;
+	if (!allyKing) {
+		return moves;
+	}
+	int kingTile = __builtin_ctzll(allyKing);
+
+	if (tile == kingTile) {
+		// Castling moves are the only two-tile king moves: the king must not be
+		// in check, nor cross or land on an attacked tile
+		uint64_t danger = attackedTiles(!color, allBoard & ~allyKing);
+		uint64_t castling = moves & ~kingAttacks[tile];
+		moves &= kingAttacks[tile] & ~danger;
+		while (castling) {
+			int endTile = __builtin_ctzll(castling);
+			castling &= castling - 1;
+			if (!(danger & (allyKing | between[tile][endTile] | (1ull << endTile)))) {
+				moves |= 1ull << endTile;
+			}
+		}
+		return moves;
+	}
+
+	// En passant removes two pieces from a row at once and is checked on its own
+	uint64_t enPassantMove = 0;
+	if ((pieceId >> 1) == 0 && enPassantTarget != -1 &&
+			((moves >> enPassantTarget) & 1) &&
+			(tile & 7) != (enPassantTarget & 7)) {
+		enPassantMove = 1ull << enPassantTarget;
+		moves &= ~enPassantMove;
+		if (!isEnPassantLegal(color, kingTile, tile)) {
+			enPassantMove = 0;
+		}
+	}
+
+	uint64_t checkers = attackersTo(kingTile, allBoard) & enemyBoard;
+	if (checkers & (checkers - 1)) {
+		return 0; // double check: only the king can move
+	}
+	if (checkers) {
+		moves &= checkers | between[kingTile][__builtin_ctzll(checkers)];
+	}
+	if ((pinnedPieces(color, kingTile) >> tile) & 1) {
+		moves &= line[kingTile][tile];
+	}
+	return moves | enPassantMove;
+}
+
+void CFBoard::generateMoves(MoveList &moveList) {
+	moveList.clear();
+
+	bool color = turn;
+	uint64_t allyBoard = color ? blackBoard : whiteBoard;
+	uint64_t enemyBoard = color ? whiteBoard : blackBoard;
+	uint64_t allBoard = whiteBoard | blackBoard;
+	uint64_t allyKing = kingBoard & allyBoard;
+
+	// Positions without a king (built with forceRemovePiece) have no checks and
+	// no pins
+	int kingTile = allyKing ? __builtin_ctzll(allyKing) : -1;
+
+	// ----- King moves -----
+	// The king is removed from the occupancy so it cannot hide behind itself
+	// from a slider it is moving away from
+	uint64_t danger = attackedTiles(!color, allBoard & ~allyKing);
+	if (kingTile != -1) {
+		pushMoves(moveList, kingTile, kingAttacks[kingTile] & ~allyBoard & ~danger);
+	}
+
+	// ----- Check and pin masks -----
+	uint64_t checkers =
+			kingTile == -1 ? 0 : attackersTo(kingTile, allBoard) & enemyBoard;
+	if (checkers & (checkers - 1)) {
+		return; // double check: only the king can move
+	}
+
+	// Tiles a non-king move must end on: anywhere, or on the checker and the
+	// tiles between it and the king
+	uint64_t checkMask = ~0ull;
+	if (checkers) {
+		checkMask = checkers | between[kingTile][__builtin_ctzll(checkers)];
+	}
+
+	// A piece is pinned when it is the only piece between our king and an enemy
+	// slider; it can then only move along the line joining them
+	uint64_t pinned = kingTile == -1 ? 0 : pinnedPieces(color, kingTile);
+
+	// ----- Knights, bishops, rooks, queens -----
+	uint64_t targets = ~allyBoard & checkMask;
+
+	// A pinned knight can never move
+	uint64_t knights = knightBoard & allyBoard & ~pinned;
+	while (knights) {
+		int tile = __builtin_ctzll(knights);
+		knights &= knights - 1;
+		pushMoves(moveList, tile, knightAttacks[tile] & targets);
+	}
+
+	uint64_t diagonalSliders = (bishopBoard | queenBoard) & allyBoard;
+	while (diagonalSliders) {
+		int tile = __builtin_ctzll(diagonalSliders);
+		diagonalSliders &= diagonalSliders - 1;
+		uint64_t moves = bishopAttacks(tile, allBoard) & targets;
+		if ((pinned >> tile) & 1) {
+			moves &= line[kingTile][tile];
+		}
+		pushMoves(moveList, tile, moves);
+	}
+
+	uint64_t cardinalSliders = (rookBoard | queenBoard) & allyBoard;
+	while (cardinalSliders) {
+		int tile = __builtin_ctzll(cardinalSliders);
+		cardinalSliders &= cardinalSliders - 1;
+		uint64_t moves = rookAttacks(tile, allBoard) & targets;
+		if ((pinned >> tile) & 1) {
+			moves &= line[kingTile][tile];
+		}
+		pushMoves(moveList, tile, moves);
+	}
+
+	// ----- Pawns -----
+	// White pawns move towards row 0, black pawns towards row 7
+	int forward = color ? 8 : -8;
+	int startRow = color ? 1 : 6;
+	uint64_t pawns = pawnBoard & allyBoard;
+	while (pawns) {
+		int tile = __builtin_ctzll(pawns);
+		pawns &= pawns - 1;
+
+		uint64_t moves = pawnAttacks[color][tile] & enemyBoard;
+		int frontTile = tile + forward;
+		if (frontTile >= 0 && frontTile < 64 && !((allBoard >> frontTile) & 1)) {
+			moves |= 1ull << frontTile;
+			int frontFrontTile = frontTile + forward;
+			if ((tile >> 3) == startRow && !((allBoard >> frontFrontTile) & 1)) {
+				moves |= 1ull << frontFrontTile;
+			}
+		}
+		moves &= checkMask;
+		if ((pinned >> tile) & 1) {
+			moves &= line[kingTile][tile];
+		}
+		while (moves) {
+			pushPawnMove(moveList, tile, __builtin_ctzll(moves));
+			moves &= moves - 1;
+		}
+	}
+
+	// En passant removes two pieces from a row at once, which the pin mask does
+	// not cover: replay the capture on the occupancy and look for sliders
+	int capturedTile = enPassantTarget - forward;
+	if (enPassantTarget != -1 &&
+			((pawnBoard & enemyBoard) >> capturedTile & 1)) {
+		uint64_t capturers =
+				pawnAttacks[!color][enPassantTarget] & pawnBoard & allyBoard;
+		while (capturers) {
+			int tile = __builtin_ctzll(capturers);
+			capturers &= capturers - 1;
+			if (kingTile != -1 && !isEnPassantLegal(color, kingTile, tile)) {
+				continue;
+			}
+			moveList.push(
+					CFMove::make(tile, enPassantTarget, CFMove::EN_PASSANT));
+		}
+	}
+
+	// ----- Castling -----
+	if (checkers || kingTile != (color ? 4 : 60)) {
+		return;
+	}
+	int castle = color ? castleCheck >> 2 : castleCheck & 3;
+	uint64_t allyRooks = rookBoard & allyBoard;
+	if ((castle & 1) && ((allyRooks >> (kingTile + 3)) & 1) &&
+			!(between[kingTile][kingTile + 3] & allBoard) &&
+			!(between[kingTile][kingTile + 3] & danger)) { // short
+		moveList.push(CFMove::make(kingTile, kingTile + 2, CFMove::CASTLING));
+	}
+	if ((castle & 2) && ((allyRooks >> (kingTile - 4)) & 1) &&
+			!(between[kingTile][kingTile - 4] & allBoard) &&
+			!(between[kingTile][kingTile - 3] & danger)) { // long
+		moveList.push(CFMove::make(kingTile, kingTile - 2, CFMove::CASTLING));
+	}
+}
+
+void CFBoard::makeMove(uint16_t move) {
+	int promotionType = -1;
+	if (CFMove::type(move) == CFMove::PROMOTION) {
+		promotionType = (CFMove::promotionType(move) << 1) | turn;
+	}
+	forceMovePiece(CFMove::startTile(move), CFMove::endTile(move), promotionType);
+
+	// generateMoves only produces legal moves
+	isStateLegal = true;
+}
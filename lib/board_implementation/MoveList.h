@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Packed moves produced by CFBoard::generateMoves.
+
+A move fits in 16 bits:
+
+    bits  0-5  : start tile
+    bits  6-11 : end tile (for castling, the tile the king lands on)
+    bits 12-13 : promotion piece, 0/1/2/3 for N/B/R/Q (only read for promotions)
+    bits 14-15 : move type, see CFMove::Type
+
+Tiles follow the CFBoard convention (0 for a8, 63 for h1).
+
+*/
+
+namespace CFMove {
+
+enum Type : uint16_t {
+	NORMAL = 0,
+	PROMOTION = 1 << 14,
+	EN_PASSANT = 2 << 14,
+	CASTLING = 3 << 14
+};
+
+/**
+ * @brief Packs a move.
+ *
+ * @param promotionType : half piece id (1/2/3/4 for N/B/R/Q) of the promoted
+ * piece, only used when type is PROMOTION.
+ */
+inline constexpr uint16_t make(int startTile, int endTile, Type type = NORMAL,
+															 int promotionType = 4) {
+	return static_cast<uint16_t>(
+			startTile | (endTile << 6) |
+			(type == PROMOTION ? (promotionType - 1) << 12 : 0) | type);
+}
+
+inline constexpr int startTile(uint16_t move) { return move & 63; }
+inline constexpr int endTile(uint16_t move) { return (move >> 6) & 63; }
+inline constexpr Type type(uint16_t move) { return Type(move & (3 << 14)); }
+
+/**
+ * @brief Half piece id (1/2/3/4 for N/B/R/Q) of the promoted piece.
+ */
+inline constexpr int promotionType(uint16_t move) {
+	return ((move >> 12) & 3) + 1;
+}
+
+} // namespace CFMove
+
+/**
+ * @brief Fixed-capacity list of packed moves, meant to live on the stack. No
+ * position has more than 218 legal moves, so it never overflows.
+ */
+struct MoveList {
+	static const int capacity = 256;
+
+	uint16_t moves[capacity];
+	int count = 0;
+
+	void push(uint16_t move) { moves[count++] = move; }
+	void clear() { count = 0; }
+	int size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	uint16_t operator[](int i) const { return moves[i]; }
+	const uint16_t *begin() const { return moves; }
+	const uint16_t *end() const { return moves + count; }
+};
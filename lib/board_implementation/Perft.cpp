@@ -0,0 +1,163 @@
+#include "Perft.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+namespace Perft {
+
+namespace {
+
+/**
+ * @brief Plays a packed move through movePiece, so the GET_LEGAL_MOVES source
+ * also exercises its legality check.
+ */
+void playWithMovePiece(CFBoard &board, uint16_t move) {
+	int promotionType = -1;
+	if (CFMove::type(move) == CFMove::PROMOTION) {
+		promotionType =
+				(CFMove::promotionType(move) << 1) | board.getCurrentPlayer();
+	}
+	board.movePiece(CFMove::startTile(move), CFMove::endTile(move),
+									promotionType);
+}
+
+void listMoves(CFBoard &board, MoveList &moveList, MoveSource source) {
+	if (source == MoveSource::GENERATE_MOVES) {
+		board.generateMoves(moveList);
+	} else {
+		getLegalMovesList(board, moveList);
+	}
+}
+
+} // namespace
+
+void getLegalMovesList(CFBoard &board, MoveList &moveList) {
+	moveList.clear();
+	bool color = board.getCurrentPlayer();
+	uint64_t colorBoard = board.getColorBitBoard(color);
+	uint64_t enemyBoard = board.getColorBitBoard(!color);
+
+	for (int startTile = 0; startTile < 64; startTile++) {
+		if (!((colorBoard >> startTile) & 1)) {
+			continue;
+		}
+		int pieceId = board.getPieceFromCoords(startTile);
+		uint64_t endTiles = board.getLegalMoves(pieceId, startTile);
+		while (endTiles) {
+			int endTile = __builtin_ctzll(endTiles);
+			endTiles &= endTiles - 1;
+
+			bool isDiagonal = (startTile & 7) != (endTile & 7);
+			if ((pieceId >> 1) == 5 && std::abs(startTile - endTile) == 2) {
+				moveList.push(CFMove::make(startTile, endTile, CFMove::CASTLING));
+			} else if ((pieceId >> 1) == 0 && (endTile <= 7 || endTile >= 56)) {
+				for (int promotionType = 4; promotionType >= 1; promotionType--) {
+					moveList.push(CFMove::make(startTile, endTile, CFMove::PROMOTION,
+																		 promotionType));
+				}
+			} else if ((pieceId >> 1) == 0 && isDiagonal &&
+								 !((enemyBoard >> endTile) & 1)) {
+				moveList.push(CFMove::make(startTile, endTile, CFMove::EN_PASSANT));
+			} else {
+				moveList.push(CFMove::make(startTile, endTile));
+			}
+		}
+	}
+}
+
+uint64_t perft(CFBoard &board, int depth, MoveSource source) {
+	if (depth <= 0) {
+		return 1;
+	}
+	MoveList moveList;
+	listMoves(board, moveList, source);
+	if (depth == 1) {
+		return moveList.size(); // bulk counting
+	}
+
+	uint64_t nodes = 0;
+	for (uint16_t move : moveList) {
+		if (source == MoveSource::GENERATE_MOVES) {
+			board.makeMove(move);
+		} else {
+			playWithMovePiece(board, move);
+		}
+		nodes += perft(board, depth - 1, source);
+		board.undoLastMove();
+	}
+	return nodes;
+}
+
+Result run(const CFBoard &board, int depth, int threads,
+					 MoveSource source) {
+	auto start = std::chrono::steady_clock::now();
+
+	Result result;
+	// No root move to split: the position itself, as perft counts it
+	if (depth < 1) {
+		result.nodes = 1;
+		return result;
+	}
+	CFBoard root = board;
+	MoveList rootMoves;
+	listMoves(root, rootMoves, source);
+	result.divide.resize(rootMoves.size());
+
+	// Workers take root moves from a shared counter until none are left
+	std::atomic<int> nextMove(0);
+	auto worker = [&]() {
+		CFBoard local = board;
+		int i;
+		while ((i = nextMove.fetch_add(1)) < rootMoves.size()) {
+			if (source == MoveSource::GENERATE_MOVES) {
+				local.makeMove(rootMoves[i]);
+			} else {
+				playWithMovePiece(local, rootMoves[i]);
+			}
+			result.divide[i] = {rootMoves[i], perft(local, depth - 1, source)};
+			local.undoLastMove();
+		}
+	};
+
+	std::vector<std::thread> pool;
+	for (int t = 1; t < std::min(threads, rootMoves.size()); t++) {
+		pool.emplace_back(worker);
+	}
+	worker();
+	for (std::thread &thread : pool) {
+		thread.join();
+	}
+
+	for (const DivideEntry &entry : result.divide) {
+		result.nodes += entry.nodes;
+	}
+	result.seconds = std::chrono::duration<double>(
+											 std::chrono::steady_clock::now() - start)
+											 .count();
+	return result;
+}
+
+std::string moveToString(uint16_t move) {
+	std::string ret;
+	for (int tile : {CFMove::startTile(move), CFMove::endTile(move)}) {
+		ret += static_cast<char>('a' + (tile & 7));
+		ret += static_cast<char>('8' - (tile >> 3));
+	}
+	if (CFMove::type(move) == CFMove::PROMOTION) {
+		ret += "nbrq"[CFMove::promotionType(move) - 1];
+	}
+	return ret;
+}
+
+void printDivide(const Result &result, std::ostream &out) {
+	for (const DivideEntry &entry : result.divide) {
+		out << moveToString(entry.move) << ": " << entry.nodes << '\n';
+	}
+	out << "\nNodes searched: " << result.nodes << '\n'
+			<< "Time: " << result.seconds << " s\n"
+			<< "Nodes/second: " << static_cast<uint64_t>(result.nodesPerSecond()) << std::endl;
+}
+
+} // namespace Perft
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CFBoard.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*---DESCRIPTION---
+
+Perft (performance test) for CFBoard: counts the leaves of the legal move tree
+up to a given depth. Node counts of well known positions are published, so any
+difference points to a move generation bug, and timing the count measures the
+speed of move generation and make/undo.
+
+Two move sources can be counted:
+- GENERATE_MOVES: CFBoard::generateMoves and CFBoard::makeMove.
+- GET_LEGAL_MOVES: getLegalMoves on every tile and movePiece, the path used by
+  the rest of the code before generateMoves existed.
+
+*/
+
+namespace Perft {
+
+enum class MoveSource { GENERATE_MOVES, GET_LEGAL_MOVES };
+
+/**
+ * @brief Number of leaves of the move tree of the given depth.
+ *
+ * @param board : position to count from, left unchanged.
+ * @param depth : number of plies, 0 returns 1.
+ */
+uint64_t perft(CFBoard &board, int depth,
+							 MoveSource source = MoveSource::GENERATE_MOVES);
+
+/**
+ * @brief Fills moveList with the legal moves given by getLegalMoves on every
+ * tile, as packed moves. Promotions are expanded into the four pieces.
+ */
+void getLegalMovesList(CFBoard &board, MoveList &moveList);
+
+struct DivideEntry {
+	uint16_t move;
+	uint64_t nodes;
+};
+
+struct Result {
+	uint64_t nodes = 0;
+	double seconds = 0;
+	std::vector<DivideEntry> divide; // one entry per root move
+
+	double nodesPerSecond() const {
+		return seconds > 0 ? static_cast<double>(nodes) / seconds : 0;
+	}
+};
+
+/**
+ * @brief Counts perft(depth) with the root moves split between threads, and
+ * keeps the count of every root move.
+ *
+ * @param board : position to count from.
+ * @param depth : number of plies. Below 1, the count is 1 (as for perft)
+ * and the divide is empty.
+ * @param threads : number of worker threads, each working on its own copy of
+ * the board.
+ */
+Result run(const CFBoard &board, int depth, int threads = 1,
+					 MoveSource source = MoveSource::GENERATE_MOVES);
+
+/**
+ * @brief Coordinate notation of a packed move, e.g. "e2e4" or "e7e8q".
+ */
+std::string moveToString(uint16_t move);
+
+/**
+ * @brief Prints one "move: nodes" line per root move, then the totals.
+ */
+void printDivide(const Result &result, std::ostream &out);
+
+} // namespace Perft
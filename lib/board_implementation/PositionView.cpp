@@ -0,0 +1,182 @@
+#include "PositionView.h"
+#include "AttackTables.h"
+#include "Zobrist.h"
+
+using namespace AttackTables;
+
+PositionView::PositionView(const CFBoard &board) {
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		typeBoards[halfPieceId] = board.getPieceBoardFromIndex(halfPieceId);
+	}
+	colorBoards[0] = board.getColorBitBoard(0);
+	colorBoards[1] = board.getColorBitBoard(1);
+	turn = board.getCurrentPlayer();
+	hash = board.getHash();
+}
+
+PositionView::PositionView() : typeBoards{}, colorBoards{}, turn(false), hash(0) {}
+
+bool PositionView::samePieces(const PositionView &other) const {
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		if (typeBoards[halfPieceId] != other.typeBoards[halfPieceId]) {
+			return false;
+		}
+	}
+	return colorBoards[0] == other.colorBoards[0] && colorBoards[1] == other.colorBoards[1];
+}
+
+int PositionView::pieceAt(int tile) const {
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		if ((typeBoards[halfPieceId] >> tile) & 1) {
+			return (halfPieceId << 1) | ((colorBoards[1] >> tile) & 1);
+		}
+	}
+	return -1;
+}
+
+int PositionView::kingTile(bool color) const {
+	uint64_t king = pieces(10 | color);
+	return king ? __builtin_ctzll(king) : -1;
+}
+
+uint64_t PositionView::attackersTo(int tile, uint64_t occupancy) const {
+	return ((pawnAttacks[0][tile] & pieces(1)) |
+					(pawnAttacks[1][tile] & pieces(0)) |
+					(knightAttacks[tile] & typeBoards[1]) |
+					(kingAttacks[tile] & typeBoards[5]) |
+					(rookAttacks(tile, occupancy) & (typeBoards[3] | typeBoards[4])) |
+					(bishopAttacks(tile, occupancy) & (typeBoards[2] | typeBoards[4]))) &
+				 occupancy;
+}
+
+uint64_t PositionView::attackedTiles(bool color, uint64_t occupancy) const {
+	uint64_t colorBoard = colorBoards[color] & occupancy;
+	uint64_t attacked = 0;
+	for (uint64_t pawns = typeBoards[0] & colorBoard; pawns; pawns &= pawns - 1) {
+		attacked |= pawnAttacks[color][__builtin_ctzll(pawns)];
+	}
+	for (uint64_t knights = typeBoards[1] & colorBoard; knights; knights &= knights - 1) {
+		attacked |= knightAttacks[__builtin_ctzll(knights)];
+	}
+	uint64_t diagonalSliders = (typeBoards[2] | typeBoards[4]) & colorBoard;
+	for (; diagonalSliders; diagonalSliders &= diagonalSliders - 1) {
+		attacked |= bishopAttacks(__builtin_ctzll(diagonalSliders), occupancy);
+	}
+	uint64_t cardinalSliders = (typeBoards[3] | typeBoards[4]) & colorBoard;
+	for (; cardinalSliders; cardinalSliders &= cardinalSliders - 1) {
+		attacked |= rookAttacks(__builtin_ctzll(cardinalSliders), occupancy);
+	}
+	for (uint64_t kings = typeBoards[5] & colorBoard; kings; kings &= kings - 1) {
+		attacked |= kingAttacks[__builtin_ctzll(kings)];
+	}
+	return attacked;
+}
+
+uint64_t PositionView::pinnedPieces(bool color, uint64_t occupancy) const {
+	int king = kingTile(color);
+	if (king == -1) {
+		return 0;
+	}
+	uint64_t snipers = ((rookAttacks(king, 0) & (typeBoards[3] | typeBoards[4])) |
+											(bishopAttacks(king, 0) & (typeBoards[2] | typeBoards[4]))) &
+										 colorBoards[!color] & occupancy;
+	uint64_t pinned = 0;
+	for (; snipers; snipers &= snipers - 1) {
+		uint64_t blockers = between[king][__builtin_ctzll(snipers)] & occupancy;
+		if ((blockers & (blockers - 1)) == 0) {
+			pinned |= blockers & colorBoards[color];
+		}
+	}
+	return pinned;
+}
+
+bool PositionView::isMoveLegal(int startTile, int endTile) const {
+	bool color = (colorBoards[1] >> startTile) & 1;
+	int king = kingTile(color);
+	if (king == -1 || king == endTile) {
+		return true;
+	}
+	if (king == startTile) {
+		king = endTile;
+	}
+	uint64_t occupancy = (this->occupancy() & ~(1ull << startTile)) | (1ull << endTile);
+	uint64_t enemies = colorBoards[!color] & ~(1ull << endTile);
+	return !(attackersTo(king, occupancy) & enemies);
+}
+
+uint64_t PositionView::legalMoves(int tile) const {
+	int pieceId = pieceAt(tile);
+	if (pieceId == -1) {
+		return 0;
+	}
+	bool color = pieceId & 1;
+	uint64_t allyBoard = colorBoards[color];
+	uint64_t enemyBoard = colorBoards[!color];
+	uint64_t allBoard = occupancy();
+
+	uint64_t moves = 0;
+	switch (pieceId >> 1) {
+	case 0: {
+		// White pawns move towards row 0, black pawns towards row 7
+		int forward = color ? 8 : -8;
+		moves = pawnAttacks[color][tile] & enemyBoard;
+		int frontTile = tile + forward;
+		if (frontTile >= 0 && frontTile < 64 && !((allBoard >> frontTile) & 1)) {
+			moves |= 1ull << frontTile;
+			if ((tile >> 3) == (color ? 1 : 6) && !((allBoard >> (frontTile + forward)) & 1)) {
+				moves |= 1ull << (frontTile + forward);
+			}
+		}
+		break;
+	}
+	case 1:
+		moves = knightAttacks[tile];
+		break;
+	case 2:
+		moves = bishopAttacks(tile, allBoard);
+		break;
+	case 3:
+		moves = rookAttacks(tile, allBoard);
+		break;
+	case 4:
+		moves = bishopAttacks(tile, allBoard) | rookAttacks(tile, allBoard);
+		break;
+	case 5:
+		// The king is removed from the occupancy so it cannot hide behind itself
+		// from a slider it is moving away from
+		return kingAttacks[tile] & ~allyBoard & ~attackedTiles(!color, allBoard & ~(1ull << tile));
+	}
+	moves &= ~allyBoard;
+
+	int king = kingTile(color);
+	if (king == -1) {
+		return moves;
+	}
+	uint64_t checkers = attackersTo(king, allBoard) & enemyBoard;
+	if (checkers & (checkers - 1)) {
+		return 0; // double check: only the king can move
+	}
+	if (checkers) {
+		moves &= checkers | between[king][__builtin_ctzll(checkers)];
+	}
+	if ((pinnedPieces(color, allBoard) >> tile) & 1) {
+		moves &= line[king][tile];
+	}
+	return moves;
+}
+
+PositionView PositionView::without(int tile) const {
+	PositionView position = *this;
+	int pieceId = pieceAt(tile);
+	if (pieceId == -1) {
+		return position;
+	}
+	position.hash ^= Zobrist::keys.piece[pieceId][tile];
+	uint64_t mask = ~(1ull << tile);
+	for (uint64_t &board : position.typeBoards) {
+		board &= mask;
+	}
+	position.colorBoards[0] &= mask;
+	position.colorBoards[1] &= mask;
+	return position;
+}
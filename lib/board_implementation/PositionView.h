@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CFBoard.h"
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Read-only snapshot of the pieces of a CFBoard, for the analysis code
+(WeakPawns, PieceMovements) that only asks questions about a position.
+
+A view is a handful of bitboards: it has no move history, copying it is
+free, and none of its methods modify it, so it can be shared by search
+threads. "What if this piece were gone" questions are answered by passing
+an occupancy without the piece instead of removing it from a board.
+
+The legal moves of a view are the ones of CFBoard::getLegalMoves without
+castling and en passant, which do not matter to the analysis.
+
+*/
+
+class PositionView {
+public:
+	/**
+	 * @brief Snapshot of board. Not explicit, so a CFBoard can be passed where
+	 * a view is expected.
+	 */
+	PositionView(const CFBoard &board);
+
+	/**
+	 * @brief Empty position.
+	 */
+	PositionView();
+
+	/**
+	 * @brief Pieces of pieceId (0/2/4/6/8/10 for P/N/B/R/Q/K, +1 if black).
+	 */
+	uint64_t pieces(int pieceId) const { return typeBoards[pieceId >> 1] & colorBoards[pieceId & 1]; }
+
+	/**
+	 * @brief Pieces of a type of both colors (pieceId >> 1).
+	 */
+	uint64_t typePieces(int halfPieceId) const { return typeBoards[halfPieceId]; }
+
+	uint64_t colorPieces(bool color) const { return colorBoards[color]; }
+
+	uint64_t occupancy() const { return colorBoards[0] | colorBoards[1]; }
+
+	bool currentPlayer() const { return turn; }
+
+	/**
+	 * @brief Zobrist key of the board (CFBoard::getHash), kept up to date by
+	 * without.
+	 */
+	uint64_t getHash() const { return hash; }
+
+	/**
+	 * @brief Whether both views have the same pieces on the same tiles.
+	 */
+	bool samePieces(const PositionView &other) const;
+
+	/**
+	 * @brief pieceId of the piece on tile, -1 if the tile is empty.
+	 */
+	int pieceAt(int tile) const;
+
+	/**
+	 * @brief Tile of the king of color, -1 without a king.
+	 */
+	int kingTile(bool color) const;
+
+	/**
+	 * @brief Pieces of both colors in occupancy attacking tile, with occupancy
+	 * used to block the sliders.
+	 */
+	uint64_t attackersTo(int tile, uint64_t occupancy) const;
+
+	/**
+	 * @brief Every tile attacked by the pieces of color in occupancy.
+	 */
+	uint64_t attackedTiles(bool color, uint64_t occupancy) const;
+
+	/**
+	 * @brief Pieces of color pinned to their king, with the given occupancy.
+	 */
+	uint64_t pinnedPieces(bool color, uint64_t occupancy) const;
+
+	/**
+	 * @brief Whether the king of the piece on startTile is safe once it moved
+	 * to endTile, replacing whatever stood there (an own piece too, to count
+	 * the pieces that could take back on endTile). Always true without a king.
+	 */
+	bool isMoveLegal(int startTile, int endTile) const;
+
+	/**
+	 * @brief Legal moves of the piece on tile, castling and en passant aside.
+	 */
+	uint64_t legalMoves(int tile) const;
+
+	/**
+	 * @brief The same position without the piece on tile.
+	 */
+	PositionView without(int tile) const;
+
+private:
+	uint64_t typeBoards[6];	 // P/N/B/R/Q/K, both colors
+	uint64_t colorBoards[2]; // white, black
+	bool turn;
+	uint64_t hash;
+};
@@ -0,0 +1,84 @@
+#include "PositionsCorpus.h"
+#include <fstream>
+#include <sstream>
+
+namespace PositionsCorpus {
+
+const std::vector<std::string> fileNames = {
+		"0_to_4_positions.txt", "6_white_6_black_positions.txt",
+		"completely_closed_positions.txt", "general_positions.txt",
+		"general_positions_spaced_pawns.txt"};
+
+std::string toFEN(const int (&topPawns)[8], const int (&bottomPawns)[8]) {
+	char board[8][8];
+	for (int row = 0; row < 8; row++) {
+		for (int col = 0; col < 8; col++) {
+			board[row][col] = '.';
+		}
+	}
+
+	const char backRank[] = "rnbqkbnr";
+	for (int col = 0; col < 8; col++) {
+		board[0][col] = backRank[col];
+		board[7][col] = backRank[col] - 'a' + 'A';
+		if (topPawns[col] > 0 && topPawns[col] < 7) {
+			board[topPawns[col]][col] = 'p';
+		}
+		if (bottomPawns[col] > 0 && bottomPawns[col] < 7) {
+			board[bottomPawns[col]][col] = 'P';
+		}
+	}
+
+	std::string fen;
+	for (int row = 0; row < 8; row++) {
+		int emptyStreak = 0;
+		for (int col = 0; col < 8; col++) {
+			if (board[row][col] == '.') {
+				emptyStreak++;
+				continue;
+			}
+			if (emptyStreak) {
+				fen.push_back(static_cast<char>('0' + emptyStreak));
+				emptyStreak = 0;
+			}
+			fen.push_back(board[row][col]);
+		}
+		if (emptyStreak) {
+			fen.push_back(static_cast<char>('0' + emptyStreak));
+		}
+		if (row < 7) {
+			fen.push_back('/');
+		}
+	}
+	return fen + " w KQkq - 0 1";
+}
+
+std::vector<std::string> loadFENs(const std::string &path) {
+	std::vector<std::string> fens;
+	std::ifstream file(path);
+	std::string line;
+	int pawns[2][8];
+	int parsed = 0;
+
+	while (std::getline(file, line)) {
+		// Lines look like "X[12] = new int[8]{4, 1, 4, 1, 1, 4, 5, 5};"
+		std::size_t open = line.find('{');
+		std::size_t close = line.find('}');
+		if (open == std::string::npos || close == std::string::npos) {
+			continue;
+		}
+		std::stringstream values(line.substr(open + 1, close - open - 1));
+		int *target = pawns[parsed & 1];
+		char comma;
+		for (int col = 0; col < 8; col++) {
+			values >> target[col];
+			values >> comma;
+		}
+		if (++parsed % 2 == 0) {
+			fens.push_back(toFEN(pawns[0], pawns[1]));
+		}
+	}
+	return fens;
+}
+
+} // namespace PositionsCorpus
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*---DESCRIPTION---
+
+Reader for the pawn skeleton corpora in the Positions/ directory.
+
+Each position is stored as two lines produced by the generator:
+
+    X[2k]   = new int[8]{...};   // row of the top (black) pawn on each file, 8 if none
+    X[2k+1] = new int[8]{...};   // row of the bottom (white) pawn on each file, -1 if none
+
+Rows use the CFBoard convention (0 for the 8th rank, 7 for the 1st rank).
+Since the corpora only contain pawns, the pieces are added on their usual
+starting squares so the positions can be played, searched and benchmarked.
+
+*/
+
+namespace PositionsCorpus {
+
+/**
+ * @brief File names of the five corpora in the Positions/ directory.
+ */
+extern const std::vector<std::string> fileNames;
+
+/**
+ * @brief Builds the FEN of a corpus position.
+ *
+ * @param topPawns : row of the black pawn on each file, 8 if there is none.
+ * @param bottomPawns : row of the white pawn on each file, -1 if there is none.
+ *
+ * @return FEN with both back ranks filled in, white to move, full castling
+ * rights.
+ */
+std::string toFEN(const int (&topPawns)[8], const int (&bottomPawns)[8]);
+
+/**
+ * @brief Reads a corpus file and returns the FEN of every position in it.
+ *
+ * @param path : path to one of the corpus files in Positions/.
+ *
+ * @return the FENs in file order, empty if the file cannot be read.
+ */
+std::vector<std::string> loadFENs(const std::string &path);
+
+} // namespace PositionsCorpus
@@ -0,0 +1,65 @@
+#include "StockfishFEN.h"
+
+std::string stockfishFEN(const CFBoard &cfb) {
+	// FEN lists the tiles from a8 to h1, the order of the CFBoard tiles (a8 = 0),
+	// so they are written in order; Position::set turns them into Stockfish
+	// squares, which count from a1.
+	char pieceChars[64] = {};
+	const char *symbols = "PpNnBbRrQqKk";
+	for (int pieceId = 0; pieceId < 12; pieceId++) {
+		uint64_t pieces = cfb.getPieceBoardFromIndex(pieceId >> 1) &
+											cfb.getColorBitBoard(pieceId & 1);
+		for (; pieces; pieces &= pieces - 1) {
+			pieceChars[__builtin_ctzll(pieces)] = symbols[pieceId];
+		}
+	}
+
+	char fen[96]; // at most 71 for the pieces and 14 for the rest
+	int length = 0;
+	for (int row = 0; row < 8; row++) {
+		if (row) {
+			fen[length++] = '/';
+		}
+		int emptyStreak = 0;
+		for (int tile = row * 8; tile < row * 8 + 8; tile++) {
+			if (!pieceChars[tile]) {
+				emptyStreak++;
+				continue;
+			}
+			if (emptyStreak) {
+				fen[length++] = static_cast<char>('0' + emptyStreak);
+				emptyStreak = 0;
+			}
+			fen[length++] = pieceChars[tile];
+		}
+		if (emptyStreak) {
+			fen[length++] = static_cast<char>('0' + emptyStreak);
+		}
+	}
+
+	fen[length++] = ' ';
+	fen[length++] = cfb.getCurrentPlayer() ? 'b' : 'w';
+	fen[length++] = ' ';
+	int castlingRights = cfb.getCastlingRights();
+	for (int right = 0; right < 4; right++) {
+		if ((castlingRights >> right) & 1) {
+			fen[length++] = "KQkq"[right];
+		}
+	}
+	if (!castlingRights) {
+		fen[length++] = '-';
+	}
+	fen[length++] = ' ';
+	int enPassantTarget = cfb.getEnPassantTarget();
+	if (enPassantTarget == -1) {
+		fen[length++] = '-';
+	} else {
+		fen[length++] = static_cast<char>('a' + (enPassantTarget & 7));
+		fen[length++] = static_cast<char>('8' - (enPassantTarget >> 3));
+	}
+	// Neither the halfmove clock nor the move number are kept by CFBoard
+	for (char c : {' ', '0', ' ', '1'}) {
+		fen[length++] = c;
+	}
+	return std::string(fen, length);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CFBoard.h"
+
+#include <string>
+
+/*---DESCRIPTION---
+
+FEN of a CFBoard written straight from its bitboards, the string handed to
+Stockfish's Position::set by the connector. It gives the same output as
+CFBoard::toFEN, without going through the board one tile at a time.
+
+It has no Stockfish dependency, so it lives with the board and is tested
+against toFEN over the positions corpora.
+
+*/
+
+/**
+ * @brief FEN of cfb, written straight from its bitboards (same output as
+ * CFBoard::toFEN).
+ */
+std::string stockfishFEN(const CFBoard &cfb);
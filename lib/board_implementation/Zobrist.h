@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Zobrist keys used by CFBoard::getHash and CFBoard::getPawnHash.
+
+The keys are generated at compile time with splitmix64 from a fixed seed, so
+hashes are identical across runs and builds and can be stored or compared
+between processes.
+
+*/
+
+namespace Zobrist {
+
+struct Keys {
+	uint64_t piece[12][64];		 // indexed by pieceId then tile
+	uint64_t castling[16];		 // indexed by the castleCheck bits
+	uint64_t enPassantFile[8]; // file of the en passant target, if any
+	uint64_t blackToMove;
+};
+
+constexpr uint64_t splitmix64(uint64_t &state) {
+	uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+constexpr Keys makeKeys() {
+	Keys k{};
+	uint64_t state = 0xC105EDF15Bull;
+	for (int pieceId = 0; pieceId < 12; pieceId++) {
+		for (int tile = 0; tile < 64; tile++) {
+			k.piece[pieceId][tile] = splitmix64(state);
+		}
+	}
+	for (int rights = 0; rights < 16; rights++) {
+		k.castling[rights] = splitmix64(state);
+	}
+	for (int file = 0; file < 8; file++) {
+		k.enPassantFile[file] = splitmix64(state);
+	}
+	k.blackToMove = splitmix64(state);
+	return k;
+}
+
+inline constexpr Keys keys = makeKeys();
+
+} // namespace Zobrist
@@ -1,3 +1,4 @@
+#include "AttackTables.h"
 #include "CFBoard.h"
 
 /**
@@ -13,6 +14,25 @@ inline bool isPositionValid(const int &row, const int &col) {
 }
 
 bool CFBoard::naiveCheckCheck(bool color, int coordA, int coordB) {
+    if (AttackTables::checkMode == AttackTables::CheckMode::CLASSIC) {
+        return naiveCheckCheckClassic(color, coordA, coordB);
+    }
+    uint64_t thisKingBoard = kingBoard & getColorBitBoard(color);
+    if (!thisKingBoard)
+        return false;
+    int kingTile = __builtin_ctzll(thisKingBoard);
+    if (kingTile == coordA && coordB != -1) {
+        // then the king moves from A to B
+        kingTile = coordB;
+    }
+    uint64_t removed = coordA != -1 ? 1ull << coordA : 0;
+    uint64_t added = coordB != -1 ? 1ull << coordB : 0;
+    uint64_t occupancy = ((whiteBoard | blackBoard) & ~removed) | added;
+    uint64_t otherBoard = getColorBitBoard(!color) & ~removed & ~added;
+    return attackersTo(kingTile, occupancy) & otherBoard;
+}
+
+bool CFBoard::naiveCheckCheckClassic(bool color, int coordA, int coordB) {
     uint64_t thisKingBoard = kingBoard & getColorBitBoard(color);
     if (!thisKingBoard)
         return false;
@@ -33,10 +53,12 @@ bool CFBoard::naiveCheckCheck(bool color, int coordA, int coordB) {
     // Check P, N
     int dx[] = {-1, -1, -1, -1, 1, 1, -2, -2, 2, 2};
     int dy[] = {-1, 1, -2, 2, -2, 2, -1, 1, -1, 1};
+    // black pawns attack downwards (towards row 7), white pawns upwards
+    int pawnDx = color ? 1 : -1;
     for (int i = 0; i < 2; i++) {
         // This loop should be unrolled
         // I hope the compiler does this for me
-        int px = kingRow + dx[i];
+        int px = kingRow + pawnDx;
         int py = kingCol + dy[i];
         uint64_t pTile = 1ll << (uint64_t)(px * 8 + py);
         if (isPositionValid(px, py) && (otherBoard & pawnBoard & pTile)) {
@@ -53,6 +75,14 @@ bool CFBoard::naiveCheckCheck(bool color, int coordA, int coordB) {
             return true;
         }
     }
+    // Check K (the kings can never stand next to each other)
+    for (int px = kingRow - 1; px <= kingRow + 1; px++) {
+        for (int py = kingCol - 1; py <= kingCol + 1; py++) {
+            if (isPositionValid(px, py) && (otherBoard & kingBoard & (1ll << (px * 8 + py)))) {
+                return true;
+            }
+        }
+    }
     // Check R
     for (int i = kingRow - 1; i >= 0; i--) {
         // Not sure if the compiler is smart enough to unroll this loop
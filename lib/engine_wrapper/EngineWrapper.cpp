@@ -3,6 +3,11 @@ void Closedfish::ChessEngine::setBoardPointer(CFBoard *board) {
 	currentBoard = board;
 }
 
+void Closedfish::ChessEngine::setSearchLimits(
+		const Closedfish::SearchLimits &limits) {
+	searchLimits = limits;
+}
+
 void Closedfish::ChessEngine::processMove(Closedfish::Move move) {
 	if (!currentBoard) {
 		throw "Board not found";
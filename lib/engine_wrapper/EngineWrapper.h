@@ -7,6 +7,17 @@ namespace Closedfish {
 // Gives you the information on next move
 typedef std::tuple<int, int, float> Move;
 
+/**
+ * @brief Budget of a getNextMove call. An engine searches deeper while the
+ * budget allows it, and always answers with the result of the last search it
+ * finished.
+ */
+struct SearchLimits {
+	int maxDepth = 3;				 // deepest search, in moves
+	double maxTime = 0;			 // wall-clock seconds, 0 for no limit
+	uint64_t maxNodes = 0; // searched positions, 0 for no limit
+};
+
 /**
  * @brief Abstract class from which all of our algorithms are gonna be derived
  */
@@ -31,11 +42,20 @@ public:
 	void setBoardPointer(CFBoard *board);
 
 	/**
-	 * @brief Make the move on the current board
+	 * @brief Sets the budget of the next getNextMove calls
+	 *
+	 * @param limits : <SearchLimits> maximum depth, time and nodes.
+	 */
+	virtual void setSearchLimits(const SearchLimits &limits);
+	const SearchLimits &getSearchLimits() const { return searchLimits; }
+
+	/**
+	 * @brief Make the move on the current board. Engines that follow the game
+	 * themselves also record it.
 	 *
 	 * @param move the move to be made
 	 */
-	void processMove(Move move);
+	virtual void processMove(Move move);
 
 	/**
 	 * @brief This function uses the current board to return
@@ -51,5 +71,6 @@ public:
 
 protected:
 	CFBoard *currentBoard;
+	SearchLimits searchLimits;
 };
 }; // namespace Closedfish
\ No newline at end of file
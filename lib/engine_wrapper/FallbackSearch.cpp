@@ -0,0 +1,66 @@
+#include "FallbackSearch.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <thread>
+
+namespace {
+
+bool isMove(const Closedfish::Move &move) {
+	return std::get<0>(move) != std::get<1>(move);
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+			.count();
+}
+
+} // namespace
+
+Closedfish::FallbackResult
+Closedfish::searchWithFallback(ChessEngine &preferred, ChessEngine &fallback,
+															 const std::function<void()> &stopFallback) {
+	auto start = std::chrono::steady_clock::now();
+	Move preferredMove;
+	double preferredTime = 0;
+	std::exception_ptr preferredError;
+	std::thread preferredThread([&] {
+		try {
+			preferredMove = preferred.getNextMove();
+		} catch (...) {
+			preferredError = std::current_exception();
+		}
+		preferredTime = secondsSince(start);
+		// The fallback move will not be played
+		if (preferredError || isMove(preferredMove)) {
+			stopFallback();
+		}
+	});
+
+	Move fallbackMove;
+	std::exception_ptr fallbackError;
+	try {
+		fallbackMove = fallback.getNextMove();
+	} catch (...) {
+		fallbackError = std::current_exception();
+	}
+	double fallbackTime = secondsSince(start);
+	// Whatever the fallback answered, the preferred search runs to its limits
+	preferredThread.join();
+
+	if (preferredError) {
+		std::rethrow_exception(preferredError);
+	}
+	FallbackResult result;
+	if (isMove(preferredMove)) {
+		result.move = preferredMove;
+		return result;
+	}
+	if (fallbackError) {
+		std::rethrow_exception(fallbackError);
+	}
+	result.move = fallbackMove;
+	result.usedFallback = true;
+	result.savedTime = std::min(preferredTime, fallbackTime);
+	return result;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "EngineWrapper.h"
+#include <functional>
+
+/*---DESCRIPTION---
+
+Concurrent fallback: two engines search the same position at once, and the move
+played is the one the sequential engine would play, the preferred engine's move
+or, when it has none, the fallback's.
+
+The fallback only saves the time it would have taken once the preferred engine
+gave up: it is stopped as soon as the preferred engine has a move, and its own
+answer never cuts the preferred search, which runs to its SearchLimits.
+
+*/
+
+namespace Closedfish {
+
+/**
+ * @brief Move of a search with a fallback, and what it saved.
+ */
+struct FallbackResult {
+	Move move;
+	bool usedFallback = false; // the preferred engine had no move
+	double savedTime = 0; // seconds both searches ran at once, 0 if unused
+};
+
+/**
+ * @brief Runs preferred on a thread of its own and fallback on the calling
+ * thread. A move from the same tile to the same tile means no move.
+ *
+ * @param preferred : engine whose move is played if it finds one. It must not
+ * share its board with fallback, since it searches on another thread.
+ * @param fallback : engine whose move is played otherwise.
+ * @param stopFallback : ends the fallback search early, called from the thread
+ * of preferred once it answered. It may come before the fallback search
+ * started or after it ended.
+ *
+ * @return the move played. savedTime is the overlap of the two searches when
+ * the fallback move is played: the sequential engine would have run them one
+ * after the other.
+ *
+ * The exception of preferred is rethrown, like the sequential engine would;
+ * the one of fallback only if its move is needed.
+ */
+FallbackResult searchWithFallback(ChessEngine &preferred,
+																	ChessEngine &fallback,
+																	const std::function<void()> &stopFallback);
+
+} // namespace Closedfish
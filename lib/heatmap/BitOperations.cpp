@@ -1,22 +1,16 @@
 #include "BitOperations.h"
 
 uint64_t reverseBit(uint64_t v) {
-	// credit to
-	// https://graphics.stanford.edu/~seander/bithacks.html#BitReverseObvious
-	uint64_t r = v; // r will be reversed bits of v; first get LSB of v
-	int s = sizeof(v) * CHAR_BIT - 1; // extra shift needed at end
-
-	for (v >>= 1; v; v >>= 1) {
-		r <<= 1;
-		r |= v & 1;
-		s--;
-	}
-	r <<= s; // shift when v's highest bits are zero
-	return r;
+	// Reverses the bits inside each byte, then the order of the bytes
+	v = ((v >> 1) & 0x5555555555555555ull) | ((v & 0x5555555555555555ull) << 1);
+	v = ((v >> 2) & 0x3333333333333333ull) | ((v & 0x3333333333333333ull) << 2);
+	v = ((v >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((v & 0x0F0F0F0F0F0F0F0Full) << 4);
+	return __builtin_bswap64(v);
 }
 
 std::vector<int> bitSetPositions(uint64_t board) {
 	std::vector<int> positions;
+	positions.reserve(__builtin_popcountll(board));
 	while (board != 0) {
 		positions.push_back(__builtin_ctzll(board));
 		uint64_t lb = board & -board; // get lowest bit
@@ -1,15 +1,13 @@
 #pragma once
 
-#ifndef CHAR_BIT
-#define CHAR_BIT (sizeof(char))
-#endif
-
 #ifdef _MSC_VER
 #include <immintrin.h>
 #include <nmmintrin.h>
 #define __builtin_popcountll _mm_popcnt_u64
 #define __builtin_ctzll _tzcnt_u64
 #define __builtin_clzll _lzcnt_u64
+#include <stdlib.h>
+#define __builtin_bswap64 _byteswap_uint64
 #endif
 
 // !!! HOTFIX (Sirawit): This should actually reuse the code from CFBoard, we
@@ -18,8 +16,39 @@
 #include <vector>
 #include <cstdint>
 
+// Mirrors the board through its center: tile t goes to 63 - t
 uint64_t reverseBit(uint64_t v);
 
 std::vector<int> bitSetPositions(uint64_t board);
 
+/**
+ * @brief Range over the set bits of a bitboard, lowest first, without
+ * allocating: for (int tile : setBits(board)) { ... }
+ */
+class SetBits {
+public:
+	class Iterator {
+	public:
+		explicit Iterator(uint64_t remaining) : board(remaining) {}
+		int operator*() const { return __builtin_ctzll(board); }
+		Iterator &operator++() {
+			board &= board - 1;
+			return *this;
+		}
+		bool operator!=(const Iterator &other) const { return board != other.board; }
+
+	private:
+		uint64_t board;
+	};
+
+	explicit SetBits(uint64_t bitboard) : board(bitboard) {}
+	Iterator begin() const { return Iterator(board); }
+	Iterator end() const { return Iterator(0); }
+
+private:
+	uint64_t board;
+};
+
+inline SetBits setBits(uint64_t board) { return SetBits(board); }
+
 bool isBitSet(const uint64_t &board, const int &tile);
\ No newline at end of file
@@ -22,8 +22,8 @@ std::vector<std::vector<int>> Heatmap::posSetFromBoard(const uint64_t &board) {
 
 bool Heatmap::squareNotAttackedByPawn(const uint64_t& opponentPawnBoard, 
 							const int& row, const int &col) {
-	return row == 7 || ((col == 0 || !isBitSet(opponentPawnBoard, posToTile({row+1, col-1})))
-				&& (col == 7 || !isBitSet(opponentPawnBoard, posToTile({row+1, col+1}))));
+	return row == 7 || ((col == 0 || !isBitSet(opponentPawnBoard, posToTile(row+1, col-1)))
+				&& (col == 7 || !isBitSet(opponentPawnBoard, posToTile(row+1, col+1))));
 }
 
 void Heatmap::displayPawnBoard(const uint64_t& pawnBoard) { // for testing only
@@ -83,14 +83,80 @@ void Heatmap::addHeatMapPieceProtect(const int &i, const int &j, int (&heatMap)[
 	}
 }
 
+namespace {
+
+const uint64_t fileA = 0x0101010101010101ull;
+const uint64_t notFileA = ~fileA;
+const uint64_t notFileH = ~(fileA << 7);
+
+// Tiles given heat by addHeatMapPieceProtect around each square, for rows 0
+// to 8: a piece attacking a pawn of row 7 from behind it stands on row 8
+struct ProtectPatterns {
+	uint64_t knight[72];
+	uint64_t bishop[72];
+	uint64_t rook[72];
+	uint64_t king[72];
+};
+
+ProtectPatterns computeProtectPatterns() {
+	ProtectPatterns patterns = {};
+	int knightDi[8] = {-1, -2, -2, -1, 1, 2, 2, 1};
+	int knightDj[8] = {2, 1, -1, -2, -2, -1, 1, 2};
+	int kingDi[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+	int kingDj[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+	auto addSquare = [](uint64_t &pattern, int i, int j) {
+		if (Heatmap::validSquare(i, j)) pattern |= 1ull << Heatmap::posToTile(i, j);
+	};
+	for (int i = 0; i <= 8; i++) {
+		for (int j = 0; j < 8; j++) {
+			int square = i * 8 + j;
+			for (int k = 0; k < 8; k++) {
+				addSquare(patterns.knight[square], i + knightDi[k], j + knightDj[k]);
+				addSquare(patterns.king[square], i + kingDi[k], j + kingDj[k]);
+			}
+			for (int k = -7; k <= 7; k++) {
+				if (k == 0) continue;
+				addSquare(patterns.bishop[square], i + k, j + k);
+				addSquare(patterns.bishop[square], i + k, j - k);
+				addSquare(patterns.rook[square], i, j + k);
+				addSquare(patterns.rook[square], i + k, j);
+			}
+		}
+	}
+	return patterns;
+}
+
+const ProtectPatterns protectPatterns = computeProtectPatterns();
+
+// Heat values stay far below the int16_t range
+inline void addHeat(int16_t &heat, int amount) {
+	heat = static_cast<int16_t>(heat + amount);
+}
+
+// Same as addHeatMapPieceProtect: amount added to the tiles of pattern that
+// are in targets
+inline void addPattern(int16_t (&heat)[64], uint64_t pattern, uint64_t targets, int amount) {
+	if (amount == 0) return;
+	for (uint64_t tiles = pattern & targets; tiles; tiles &= tiles - 1) {
+		addHeat(heat[__builtin_ctzll(tiles)], amount);
+	}
+}
+
+} // namespace
+
 void Heatmap::addHeatMap(CFBoard& board, int (&heatMap)[6][8][8], const uint64_t &weakPawns) {
-	uint64_t maskRow[8], maskCol[8]; // 1 for one column or one row, 0 otherwise
-	maskRow[0] = (1LL<<8)-1;
-	maskCol[0] = 1LL + (1LL<<8) + (1LL<<16) + (1LL<<24) + (1LL<<32) + (1LL<<40) + (1LL<<48) + (1LL<<56);
-	for (int i = 1; i < 8; i++) {
-		maskRow[i] = maskRow[i-1]<<8;
-		maskCol[i] = maskCol[i-1]<<1;
+	int16_t flatHeatMap[6][64];
+	buildHeatMap(board, flatHeatMap, weakPawns);
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		for (int tile = 0; tile < 64; tile++) {
+			heatMap[halfPieceId][tile / 8][tile % 8] += flatHeatMap[halfPieceId][tile];
+		}
 	}
+}
+
+void Heatmap::buildHeatMap(CFBoard& board, int16_t (&heatMap)[6][64], const uint64_t &weakPawns) {
+	memset(heatMap, 0, sizeof heatMap);
+	const ProtectPatterns &patterns = protectPatterns;
 
 	bool currentTurn = board.getCurrentPlayer(); // 0: white, 1: black
 	uint64_t pawnBoard = board.getPieceColorBitBoard(0|currentTurn),
@@ -98,7 +164,8 @@ void Heatmap::addHeatMap(CFBoard& board, int (&heatMap)[6][8][8], const uint64_t
 	bishopBoard = board.getPieceColorBitBoard(4|currentTurn),
 	rookBoard = board.getPieceColorBitBoard(6|currentTurn),
 	queenBoard = board.getPieceColorBitBoard(8|currentTurn),
-	kingBoard = board.getPieceColorBitBoard(10|currentTurn);
+	kingBoard = board.getPieceColorBitBoard(10|currentTurn),
+	opponentPawnBoard = board.getPieceColorBitBoard(0|(!currentTurn));
 	if (!currentTurn) { // switch orientation from white to black for easier code
 		pawnBoard = reverseBit(pawnBoard);
 		knightBoard = reverseBit(knightBoard);
@@ -106,6 +173,7 @@ void Heatmap::addHeatMap(CFBoard& board, int (&heatMap)[6][8][8], const uint64_t
 		rookBoard = reverseBit(rookBoard);
 		queenBoard = reverseBit(queenBoard);
 		kingBoard = reverseBit(kingBoard);
+		opponentPawnBoard = reverseBit(opponentPawnBoard);
 	}
 
 	// Counting pieces
@@ -114,253 +182,144 @@ void Heatmap::addHeatMap(CFBoard& board, int (&heatMap)[6][8][8], const uint64_t
 		noQueens = __builtin_popcountll(queenBoard);
 
 	// Count how many light and dark squared bishop
-	int noBishopsColor[2] = {0, 0};
-	std::vector<int> bishop_tiles = bitSetPositions(bishopBoard);
-	for (int tile: bishop_tiles) {
-		int row = tile/8, col = tile%8;
-		noBishopsColor[(row+col)%2]++;
-	}
-
-	int pawnHeight[8] = {8, 8, 8, 8, 8, 8, 8, 8};
-	// displayPawnBoard(pawnBoard);
-	for (int i = 0; i < 8; i++) { 
-		uint64_t pawnRow = (pawnBoard & maskRow[i]) >> (8*i);
-		if (!pawnRow) continue;
-		for (int j = 0; j < 8; j++) {
-			if ((pawnRow >> j)&1 && pawnHeight[j] == 8) {
-				pawnHeight[j] = i;
-			}
-		}
-	}
+	const uint64_t darkTiles = 0xAA55AA55AA55AA55ull; // (row + col) odd
+	int noBishopsColor[2] = {__builtin_popcountll(bishopBoard & ~darkTiles), __builtin_popcountll(bishopBoard & darkTiles)};
 
-	// Calculating pawn heights of each column
-	std::vector<int> openFiles;
+	// Row of the lowest pawn of each column, 8 if there is none; the tiles below
+	// the pawns are the ones pieces can go to
+	int pawnHeight[8];
+	uint64_t belowPawns = 0;
 	for (int j = 0; j < 8; j++) {
-		if (pawnHeight[j] == 8) {
-			openFiles.push_back(j);
-		}
+		uint64_t filePawns = pawnBoard & (fileA << j);
+		pawnHeight[j] = filePawns ? __builtin_ctzll(filePawns) / 8 : 8;
+		belowPawns |= filePawns ? (fileA << j) & ((filePawns & -filePawns) - 1) : fileA << j;
 	}
 
-	// Number of free rows below the lowest pawn
-	int free_rows = (*std::min_element(pawnHeight, pawnHeight+8)); // number of rows below the lowest pawn
-	// std::cout << free_rows << '\n';
-	
-	uint64_t opponentPawnBoard = board.getPieceColorBitBoard(0|(!currentTurn));
-	if (!currentTurn) {
-		opponentPawnBoard = reverseBit(opponentPawnBoard);
-	}
-	if (openFiles.size() > 0) { // there exists open files
-		for (int j: openFiles) {
-			int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
-
-			// Rooks and Queens move to open file, priotizing staying on the lowest rank
-			for (int i = 0; i < maxPawnHeight; i++) {
-				if (squareNotAttackedByPawn(opponentPawnBoard, i, j)) // no opposing pawns
-					heatMap[3][i][j] += std::max(pawnHeight[j]+1 - i + noRooks, 0); // weighted since they are more important
-					heatMap[4][i][j] += std::max(pawnHeight[j]+1 - i + noQueens, 0); // weighted since they are more important
-			}
+	// Opponent pawns attack the tiles of the row below them
+	uint64_t attacked = ((opponentPawnBoard >> 9) & notFileH) | ((opponentPawnBoard >> 7) & notFileA);
+	uint64_t targets = belowPawns & ~attacked;
 
-			// Knights move to square near open file, defending the nearby pawns and pieces
+	// Number of free rows below the lowest pawn
+	int freeRows = *std::min_element(pawnHeight, pawnHeight + 8);
+	int opponentMaterial = board.getMaterialCount(!currentTurn);
+	int threshold = 15; // to be adjusted
 
-			// defend open file
-			for (int i = 0; i < maxPawnHeight; i++) {
-				addHeatMapPieceProtect(i, j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
-			}
-			// protect left pawn
-			if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
-				addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
-			}
-			// protect right pawn
-			if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
-				addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
-			}
+	bool openFiles = false;
+	for (int j = 0; j < 8; j++) {
+		if (pawnHeight[j] != 8) continue;
+		openFiles = true;
+		int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
 
-			// Bishops also move to square near open file, defending the nearby pawns and pieces
+		for (int i = 0; i < maxPawnHeight; i++) {
+			int tile = i * 8 + j;
+			// Rooks and Queens move to open file, priotizing staying on the lowest rank.
+			// As in the original implementation, only the rook heat avoids the opposing pawns
+			if (!((attacked >> tile) & 1))
+				addHeat(heatMap[3][tile], std::max(pawnHeight[j]+1 - i + noRooks, 0));
+			addHeat(heatMap[4][tile], std::max(pawnHeight[j]+1 - i + noQueens, 0));
 
-			//defend open file
-			for (int i = 0; i < maxPawnHeight; i++) {
-				bool bishop_color = (i+j)%2;
-				addHeatMapPieceProtect(i, j, heatMap, 'B', noBishopsColor[bishop_color], opponentPawnBoard, pawnHeight);
-			}
-			// protect left pawn
-			if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
-				addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j-1]+j)%2],
-										opponentPawnBoard, pawnHeight);
-			}
-			// protect right pawn
-			if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
-				addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j-1]+j)%2],
-										opponentPawnBoard, pawnHeight);
-			}
+			// Knights and bishops move to square near open file, defending it
+			addPattern(heatMap[1], patterns.knight[tile], targets, noKnights);
+			addPattern(heatMap[2], patterns.bishop[tile], targets, noBishopsColor[(i+j)%2]);
+		}
+		// ... and the nearby pawns
+		if (j >= 1 && pawnHeight[j-1] < 8) {
+			int tile = pawnHeight[j-1] * 8 + j;
+			addPattern(heatMap[1], patterns.knight[tile], targets, noKnights);
+			addPattern(heatMap[2], patterns.bishop[tile], targets, noBishopsColor[(pawnHeight[j-1]+j)%2]);
 		}
-	} else { // No open files
-		// std::cout << free_rows << '\n';
-		std::vector<int> weakPawnFiles;
+		if (j <= 6 && pawnHeight[j+1] < 8) {
+			int tile = pawnHeight[j+1] * 8 + j;
+			addPattern(heatMap[1], patterns.knight[tile], targets, noKnights);
+			addPattern(heatMap[2], patterns.bishop[tile], targets, noBishopsColor[(pawnHeight[j+1]+j)%2]);
+		}
+	}
+
+	if (!openFiles) {
+		// Define "area" the spaces that pieces are free to move, each area is separated by a pawn of height 1.
+		// With 2 free rows, knights, rooks and queens are essentially able to go anywhere: the weights
+		// do not depend on the areas.
+		int numArea[8];
+		int cur = 0;
 		for (int i = 0; i < 8; i++) {
-			if (weakPawns & (1ll<<i)) { // ith bit is set
-				weakPawnFiles.push_back(i);
+			if (pawnHeight[i] == 1 && i != 0) {
+				numArea[i] = 2*cur+1;
+				cur++;
+			} else {
+				numArea[i] = 2*cur;
 			}
 		}
-		if (free_rows >= 2) { // 2 free rows, knights, rooks and queens are essentially able to go anywhere
-			// To be adjusted
-			for (int j: weakPawnFiles) {
-				int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
+		int countArea = numArea[7];
 
+		for (int j = 0; j < 8; j++) {
+			if (!(weakPawns & (1ll<<j))) continue;
+			int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
+			int opponentPawnHeight = pawnHeight[j]+1;
+			int weakTile = opponentPawnHeight * 8 + j;
+			int leftTile = j >= 1 ? pawnHeight[j-1] * 8 + j : -1;
+			int rightTile = j <= 6 ? pawnHeight[j+1] * 8 + j : -1;
+			// Weight of a piece on column col: smaller if it is in an area far from the weak pawn
+			auto areaWeight = [&](int col) { return countArea - abs(numArea[j] - numArea[col]); };
+
+			if (freeRows >= 2) {
 				// Rooks move to behind the weak pawn, priotizing staying on the lowest rank
 				for (int i = 0; i < maxPawnHeight; i++) {
-					if (squareNotAttackedByPawn(opponentPawnBoard, i, j)) // no opposing pawns
-						heatMap[3][i][j] += std::max(pawnHeight[j]+1 - i + noRooks, 0);
+					if (!((attacked >> (i * 8 + j)) & 1))
+						addHeat(heatMap[3][i * 8 + j], std::max(pawnHeight[j]+1 - i + noRooks, 0));
 				}
-
-				int opponentPawnHeight = pawnHeight[j]+1;
-				// Queens attack weak pawns from the diagonals and the column
-				addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'Q', noQueens, opponentPawnBoard, pawnHeight);
-
-				// Knights move to square near weak pawn, attacking it
-				addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
-
+				// Queens attack weak pawns from the diagonals and the column, knights from near it
+				addPattern(heatMap[4], patterns.bishop[weakTile] | patterns.rook[weakTile], targets, noQueens);
+				addPattern(heatMap[1], patterns.knight[weakTile], targets, noKnights);
 				// Bishops attack weak pawns or defend current pawns, depends on the color of the bishop
-				// attacking
-				addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'B', noBishopsColor[(j+opponentPawnHeight)%2], opponentPawnBoard, pawnHeight);
-				// protect left pawn
-				if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
-					addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j-1]+j)%2],
-											opponentPawnBoard, pawnHeight);
-				}
-				// protect right pawn
-				if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
-					addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j+1]+j)%2],
-											opponentPawnBoard, pawnHeight);
-				}
-
-				// King moves to near weak pawns, protect nearby pawns if opponent does not have many materials left on the board.
-				//														otherwise, stay as far as possible
-				int threshold = 15; // to be adjusted
-				int opponentMaterial = board.getMaterialCount(!currentTurn);
-				if (opponentMaterial < threshold) {
-					// protect left pawn
-					if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
-						addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
-					}
-					// protect right pawn
-					if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
-						addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
-					}
-				} else {
-					// stay in the left if weak pawn in the right
-					if (j >= 4) {
-						addHeatMapPieceProtect(0, 0, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
-					}
-					// stay in the right otherwise
-					else {
-						addHeatMapPieceProtect(0, 7, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
-					}
-				}
-			} 
-		} else {
-			// Define "area" the spaces that pieces are free to move, each area is separated by a pawn of height 1
-
-			// Pieces are more limited to their own "area", hence smaller coefficients added to
-			// squares outside of their "area" since it takes more turns to move them there.
-			
-			int numArea[8];
-			int cur = 0;
-			for (int i = 0; i < 8; i++) {
-				if (pawnHeight[i] == 1 && i != 0) {
-					numArea[i] = 2*cur+1;
-					cur++;
-				} else {
-					numArea[i] = 2*cur;
-				}
-			}
-			int countArea = numArea[7];
-			int distArea[8][8];
-			for (int j1 = 0; j1 < 8; j1++) {
-				for (int j2 = 0; j2 < 8; j2++) {
-					distArea[j1][j2] = countArea - abs(numArea[j1] - numArea[j2]); // gets smaller if two areas are far apart
-				}
-			}
-			
-			std::vector<std::vector<int>> knightPos = posSetFromBoard(knightBoard),
-										bishopPos = posSetFromBoard(bishopBoard), 
-										rookPos = posSetFromBoard(rookBoard), 
-										queenPos = posSetFromBoard(queenBoard), 
-										kingPos = posSetFromBoard(kingBoard);
-			// To be adjusted
-			for (int j: weakPawnFiles) {
-				int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
-
-				// Rooks move to behind the weak pawn, priotizing staying on the lowest rank
+				addPattern(heatMap[2], patterns.bishop[weakTile], targets, noBishopsColor[(j+opponentPawnHeight)%2]);
+				if (leftTile != -1)
+					addPattern(heatMap[2], patterns.bishop[leftTile], targets, noBishopsColor[(pawnHeight[j-1]+j)%2]);
+				if (rightTile != -1)
+					addPattern(heatMap[2], patterns.bishop[rightTile], targets, noBishopsColor[(pawnHeight[j+1]+j)%2]);
+			} else {
 				for (int i = 0; i < maxPawnHeight; i++) {
-					if (squareNotAttackedByPawn(opponentPawnBoard, i, j)) { // no opposing pawns 
-						for (std::vector<int> pos: rookPos)
-							heatMap[3][i][j] += std::max(pawnHeight[j]+1 - i + distArea[j][pos[1]], 0);
-					}
+					if ((attacked >> (i * 8 + j)) & 1) continue;
+					for (uint64_t rooks = rookBoard; rooks; rooks &= rooks - 1)
+						addHeat(heatMap[3][i * 8 + j], std::max(pawnHeight[j]+1 - i + areaWeight(__builtin_ctzll(rooks) % 8), 0));
 				}
-
-				int opponentPawnHeight = pawnHeight[j]+1;
-				// Queens attack weak pawns from the diagonals and the column
-				for (std::vector<int> pos: queenPos)
-					addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'Q', 1, opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
-
-				// Knights move to square near weak pawn, attacking it
-				for (std::vector<int> pos: knightPos)
-					addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'N', 1, opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
-
-				// Bishops attack weak pawns or defend current pawns, depends on the color of the bishop
-				// attacking
-				for (std::vector<int> pos: bishopPos) {
-					bool bishopColor = (pos[0]+pos[1])%2;
+				for (uint64_t queens = queenBoard; queens; queens &= queens - 1)
+					addPattern(heatMap[4], patterns.bishop[weakTile] | patterns.rook[weakTile], targets,
+										 areaWeight(__builtin_ctzll(queens) % 8));
+				for (uint64_t knights = knightBoard; knights; knights &= knights - 1)
+					addPattern(heatMap[1], patterns.knight[weakTile], targets, areaWeight(__builtin_ctzll(knights) % 8));
+				for (uint64_t bishops = bishopBoard; bishops; bishops &= bishops - 1) {
+					int tile = __builtin_ctzll(bishops);
+					int weight = areaWeight(tile % 8);
+					bool bishopColor = (tile / 8 + tile % 8) % 2;
 					if ((j+opponentPawnHeight)%2 == bishopColor)
-						addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'B', 1,
-											opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
-					// protect left pawn
-					if (j >= 1 && validSquare(pawnHeight[j-1], j) && (pawnHeight[j-1]+j)%2 == bishopColor) {
-						addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'B', 1,
-												opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
-					}
-					// protect right pawn
-					if (j <= 6 && validSquare(pawnHeight[j+1], j) && (pawnHeight[j+1]+j)%2 == bishopColor) {
-						addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'B', 1,
-												opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
-					}
+						addPattern(heatMap[2], patterns.bishop[weakTile], targets, weight);
+					if (leftTile != -1 && (pawnHeight[j-1]+j)%2 == bishopColor)
+						addPattern(heatMap[2], patterns.bishop[leftTile], targets, weight);
+					if (rightTile != -1 && (pawnHeight[j+1]+j)%2 == bishopColor)
+						addPattern(heatMap[2], patterns.bishop[rightTile], targets, weight);
 				}
+			}
 
-				// King moves to near weak pawns, protect nearby pawns if opponent does not have many materials left on the board.
-				//														otherwise, stay as far as possible
-				int threshold = 15; // to be adjusted
-				int opponentMaterial = board.getMaterialCount(!currentTurn);
-				int kingCol = kingPos[0][1];
-				if (opponentMaterial < threshold) {
-					// protect left pawn
-					if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
-						addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
-					}
-					// protect right pawn
-					if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
-						addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
-					}
-				} else {
-					// stay in the left if weak pawn in the right
-					if (j >= 4) {
-						addHeatMapPieceProtect(0, 0, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
-					}
-					// stay in the right otherwise
-					else {
-						addHeatMapPieceProtect(0, 7, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
-					}
-				}
-			} 
+			// King moves to near weak pawns, protect nearby pawns if opponent does not have many materials left on the board.
+			//														otherwise, stay as far as possible
+			if (freeRows < 2 && !kingBoard) continue;
+			int kingWeight = freeRows >= 2 ? 1 : areaWeight(__builtin_ctzll(kingBoard) % 8);
+			if (opponentMaterial < threshold) {
+				if (leftTile != -1)
+					addPattern(heatMap[5], patterns.king[leftTile], targets, kingWeight);
+				if (rightTile != -1)
+					addPattern(heatMap[5], patterns.king[rightTile], targets, kingWeight);
+			} else {
+				// stay in the left if weak pawn in the right, in the right otherwise
+				addPattern(heatMap[5], patterns.king[j >= 4 ? 0 : 7], targets, kingWeight);
+			}
 		}
 	}
+
 	// Switch back to white's orientation if white's turn
 	if (!currentTurn) {
 		for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
-			for (int i = 0; i < 4; i++) {
-				for (int j = 0; j < 8; j++) {
-					std::swap(heatMap[halfPieceId][i][j], heatMap[halfPieceId][7-i][7-j]);
-				}
-			}
+			std::reverse(heatMap[halfPieceId], heatMap[halfPieceId] + 64);
 		}
 	}
 }
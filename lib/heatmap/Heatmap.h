@@ -43,6 +43,17 @@ namespace Heatmap {
 	int posToTile(std::vector<int> pos);
 
 
+	/**
+	* @brief Same as above, without building a vector.
+	*
+	* @param row : <int> the row of the tile
+	* @param col : <int> the column of the tile
+	*
+	* @return  <int> the 0-63 integer corresponding to a bitboard index
+	*/
+	inline int posToTile(int row, int col) { return row * 8 + col; }
+
+
 	/**
 	*@brief This function takes a bit board and returns a vector containing the position tuples of all the 1s on it.
 	*
@@ -71,7 +82,7 @@ namespace Heatmap {
 
 
 	/**
-	* @brief The main function that takes an int[6][8][8] by reference, and stores the heatmap there.
+	* @brief The main function that takes an int[6][8][8] by reference, and adds the heatmap to it.
 	*
 	* @param board : the current board instance.
 	* @param heatMap : the variable that the heatmap will be stored in. 
@@ -80,5 +91,17 @@ namespace Heatmap {
 	*/
 	void addHeatMap(CFBoard& board, int(&heatMap)[6][8][8], const uint64_t& weakPawns);
 
+
+	/**
+	* @brief Builds the same heatmap as addHeatMap into a flat array indexed by tile (row * 8 + col), overwriting it.
+	* Works on the pawn heights and attack bitboards of the position, without any heap allocation.
+	*
+	* @param board : the current board instance.
+	* @param heatMap : the variable that the heatmap will be stored in.
+	* @param weakPawns : the bitboard obtained by running weak pawns.
+	*
+	*/
+	void buildHeatMap(CFBoard& board, int16_t(&heatMap)[6][64], const uint64_t& weakPawns);
+
 }
 
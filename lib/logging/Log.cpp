@@ -0,0 +1,197 @@
+#include "Log.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Closedfish {
+namespace Log {
+
+namespace detail {
+std::atomic<int> minimumLevel(int(Level::Off));
+} // namespace detail
+
+namespace {
+
+const size_t ringCapacity = 256; // lines per thread
+
+struct ThreadRing {
+	std::shared_ptr<LogRing> ring;
+	int number = 0;
+};
+
+// Everything the background thread works with
+struct Writer {
+	std::mutex ringsMutex; // guards rings and threadCount
+	std::vector<std::shared_ptr<LogRing>> rings;
+	int threadCount = 0;
+	uint64_t droppedByEndedThreads = 0;
+
+	std::mutex outputMutex; // guards output, only one thread writes at a time
+	FILE *output = nullptr;
+
+	std::mutex wakeMutex; // guards running
+	std::condition_variable wake;
+	bool running = false;
+	std::thread thread;
+	// steady_clock time of start, read by the threads that log
+	std::atomic<std::chrono::steady_clock::rep> startTime{0};
+
+	~Writer() { stop(); }
+};
+
+Writer writer;
+
+thread_local ThreadRing threadRing;
+
+ThreadRing &ringOfThisThread() {
+	if (!threadRing.ring) {
+		threadRing.ring = std::make_shared<LogRing>(ringCapacity);
+		std::lock_guard<std::mutex> lock(writer.ringsMutex);
+		writer.rings.push_back(threadRing.ring);
+		threadRing.number = writer.threadCount++;
+	}
+	return threadRing;
+}
+
+// Writes the lines of every ring, and forgets the rings of ended threads
+void writeRings() {
+	std::vector<std::shared_ptr<LogRing>> rings;
+	{
+		std::lock_guard<std::mutex> lock(writer.ringsMutex);
+		rings = writer.rings;
+	}
+	std::lock_guard<std::mutex> lock(writer.outputMutex);
+	if (!writer.output) {
+		return;
+	}
+	std::string line;
+	for (const std::shared_ptr<LogRing> &ring : rings) {
+		while (ring->pop(line)) {
+			line.push_back('\n');
+			fwrite(line.data(), 1, line.size(), writer.output);
+		}
+	}
+	fflush(writer.output);
+
+	std::lock_guard<std::mutex> ringsLock(writer.ringsMutex);
+	for (size_t i = 0; i < writer.rings.size();) {
+		// Only the list and the copy above are left: the thread is gone
+		if (writer.rings[i].use_count() == 2) {
+			writer.droppedByEndedThreads += writer.rings[i]->droppedLines();
+			writer.rings[i] = writer.rings.back();
+			writer.rings.pop_back();
+		} else {
+			i++;
+		}
+	}
+}
+
+void writeLoop(std::chrono::milliseconds interval) {
+	std::unique_lock<std::mutex> lock(writer.wakeMutex);
+	while (writer.running) {
+		writer.wake.wait_for(lock, interval, [] { return !writer.running; });
+		lock.unlock();
+		writeRings();
+		lock.lock();
+	}
+}
+
+const char *levelName(Level level) {
+	static const char *names[] = {"TRACE", "DEBUG", "INFO", "WARNING", "ERROR"};
+	return names[int(level)];
+}
+
+} // namespace
+
+bool start(Level level, const std::string &path, int flushMilliseconds) {
+	stop();
+	FILE *output = path.empty() ? stderr : fopen(path.c_str(), "a");
+	if (!output) {
+		return false;
+	}
+	{
+		std::lock_guard<std::mutex> lock(writer.outputMutex);
+		writer.output = output;
+	}
+	writer.startTime.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+												 std::memory_order_relaxed);
+	writer.running = true;
+	writer.thread = std::thread(writeLoop, std::chrono::milliseconds(flushMilliseconds));
+	detail::minimumLevel.store(int(level), std::memory_order_relaxed);
+	return true;
+}
+
+void stop() {
+	detail::minimumLevel.store(int(Level::Off), std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> lock(writer.wakeMutex);
+		if (!writer.running) {
+			return;
+		}
+		writer.running = false;
+	}
+	writer.wake.notify_one();
+	writer.thread.join();
+	writeRings();
+	std::lock_guard<std::mutex> lock(writer.outputMutex);
+	if (writer.output != stderr) {
+		fclose(writer.output);
+	}
+	writer.output = nullptr;
+}
+
+void flush() { writeRings(); }
+
+void setLevel(Level level) {
+	std::lock_guard<std::mutex> lock(writer.wakeMutex);
+	if (writer.running) {
+		detail::minimumLevel.store(int(level), std::memory_order_relaxed);
+	}
+}
+
+uint64_t droppedLines() {
+	std::lock_guard<std::mutex> lock(writer.ringsMutex);
+	uint64_t dropped = writer.droppedByEndedThreads;
+	for (const std::shared_ptr<LogRing> &ring : writer.rings) {
+		dropped += ring->droppedLines();
+	}
+	return dropped;
+}
+
+namespace detail {
+
+Line::Line(Level level) : length(0) {
+	std::chrono::steady_clock::duration elapsed(
+			std::chrono::steady_clock::now().time_since_epoch().count() -
+			writer.startTime.load(std::memory_order_relaxed));
+	append(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+	append(" [");
+	append(ringOfThisThread().number);
+	append("] ");
+	append(levelName(level));
+	append(' ');
+}
+
+void Line::append(double value) {
+	char digits[32];
+	int digitCount = snprintf(digits, sizeof digits, "%g", value);
+	append(digits, std::min<size_t>(digitCount, sizeof digits - 1));
+}
+
+void Line::append(const char *textToAdd, size_t textLength) {
+	size_t added = std::min(textLength, sizeof text - length);
+	memcpy(text + length, textToAdd, added);
+	length += added;
+}
+
+void Line::commit() { ringOfThisThread().ring->push(text, length); }
+
+} // namespace detail
+
+} // namespace Log
+} // namespace Closedfish
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "LogRing.h"
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+/*---DESCRIPTION---
+
+Leveled logging, cheap enough to stay in the search code of release builds.
+
+	CF_LOG_INFO("depth ", depth, " nodes ", nodes);
+
+A call below CF_LOG_COMPILE_LEVEL (trace by default in debug builds, debug
+otherwise) is compiled out. A call below the level given to Log::start, or
+made while the log is stopped, costs one relaxed atomic load: its arguments
+are not even evaluated.
+
+An enabled call formats its arguments into a line on the stack and pushes it,
+without a lock, to a LogRing of the calling thread. A background thread
+writes the lines of every thread to a file or to stderr a few times a
+second, so the searching threads never wait for the output; when a ring is
+full its new lines are dropped and counted. Lines are prefixed with the
+milliseconds since Log::start and the number of the thread, since lines of
+different threads are written ring by ring.
+
+*/
+
+#ifndef CF_LOG_COMPILE_LEVEL
+#ifdef DEBUG
+#define CF_LOG_COMPILE_LEVEL 0
+#else
+#define CF_LOG_COMPILE_LEVEL 1
+#endif
+#endif
+
+namespace Closedfish {
+namespace Log {
+
+enum class Level { Trace, Debug, Info, Warning, Error, Off };
+
+/**
+ * @brief Starts writing the lines of level and above, to the file at path
+ * (appended to) or to stderr if path is empty. Restarts the log if it was
+ * running.
+ *
+ * @param flushMilliseconds : time between two writes of the background thread.
+ * @return false if the file cannot be opened; the log is then stopped.
+ */
+bool start(Level level, const std::string &path = "", int flushMilliseconds = 50);
+
+/**
+ * @brief Writes the lines left and stops the background thread. Also done at
+ * exit.
+ */
+void stop();
+
+/**
+ * @brief Writes every line pushed so far, from the calling thread.
+ */
+void flush();
+
+/**
+ * @brief Changes the level of a running log.
+ */
+void setLevel(Level level);
+
+/**
+ * @brief Lines dropped because the ring of their thread was full.
+ */
+uint64_t droppedLines();
+
+namespace detail {
+
+// Lowest level written, Off while the log is stopped
+extern std::atomic<int> minimumLevel;
+
+/**
+ * @brief A line being formatted, pushed to the ring of the thread by commit.
+ */
+class Line {
+public:
+	explicit Line(Level level);
+
+	void append(const char *textToAdd) { append(textToAdd, strlen(textToAdd)); }
+	void append(const std::string &textToAdd) {
+		append(textToAdd.data(), textToAdd.size());
+	}
+	void append(char c) { append(&c, 1); }
+	void append(bool value) { append(value ? "true" : "false"); }
+	void append(double value);
+	template <typename Integer,
+						typename = std::enable_if_t<std::is_integral<Integer>::value>>
+	void append(Integer value) {
+		char digits[24];
+		char *end = std::to_chars(digits, digits + sizeof digits, value).ptr;
+		append(digits, end - digits);
+	}
+
+	void commit();
+
+private:
+	void append(const char *text, size_t textLength);
+
+	char text[LogRing::lineSize];
+	size_t length;
+};
+
+} // namespace detail
+
+inline bool enabled(Level level) {
+	return int(level) >= detail::minimumLevel.load(std::memory_order_relaxed);
+}
+
+template <typename... Args> void write(Level level, const Args &...args) {
+	detail::Line line(level);
+	(line.append(args), ...);
+	line.commit();
+}
+
+} // namespace Log
+} // namespace Closedfish
+
+#define CF_LOG(level, ...)                                                     \
+	do {                                                                         \
+		if constexpr (int(level) >= CF_LOG_COMPILE_LEVEL) {                        \
+			if (Closedfish::Log::enabled(level)) {                                   \
+				Closedfish::Log::write(level, __VA_ARGS__);                            \
+			}                                                                        \
+		}                                                                          \
+	} while (0)
+
+#define CF_LOG_TRACE(...) CF_LOG(Closedfish::Log::Level::Trace, __VA_ARGS__)
+#define CF_LOG_DEBUG(...) CF_LOG(Closedfish::Log::Level::Debug, __VA_ARGS__)
+#define CF_LOG_INFO(...) CF_LOG(Closedfish::Log::Level::Info, __VA_ARGS__)
+#define CF_LOG_WARNING(...) CF_LOG(Closedfish::Log::Level::Warning, __VA_ARGS__)
+#define CF_LOG_ERROR(...) CF_LOG(Closedfish::Log::Level::Error, __VA_ARGS__)
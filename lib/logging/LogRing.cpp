@@ -0,0 +1,66 @@
+#include "LogRing.h"
+#include <cstring>
+
+namespace Closedfish {
+
+LogRing::LogRing(size_t capacity) : head(0), tail(0), dropped(0) {
+	size_t size = 1;
+	while (size < capacity) {
+		size <<= 1;
+	}
+	mask = size - 1;
+	slots.reset(new Slot[size]);
+	for (size_t i = 0; i < size; i++) {
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+bool LogRing::push(const char *text, size_t length) {
+	size_t position = head.load(std::memory_order_relaxed);
+	Slot *slot;
+	while (true) {
+		slot = &slots[position & mask];
+		size_t sequence = slot->sequence.load(std::memory_order_acquire);
+		intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+		if (difference == 0) {
+			if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (difference < 0) {
+			// The slot still holds the line pushed a whole ring ago
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		} else {
+			position = head.load(std::memory_order_relaxed);
+		}
+	}
+	slot->length = length < lineSize ? length : lineSize;
+	memcpy(slot->text, text, slot->length);
+	slot->sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+bool LogRing::pop(std::string &line) {
+	size_t position = tail.load(std::memory_order_relaxed);
+	Slot *slot;
+	while (true) {
+		slot = &slots[position & mask];
+		size_t sequence = slot->sequence.load(std::memory_order_acquire);
+		intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+		if (difference == 0) {
+			if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return false; // not filled yet
+		} else {
+			position = tail.load(std::memory_order_relaxed);
+		}
+	}
+	line.assign(slot->text, slot->length);
+	// Free for the push one ring later
+	slot->sequence.store(position + mask + 1, std::memory_order_release);
+	return true;
+}
+
+} // namespace Closedfish
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+/*---DESCRIPTION---
+
+Bounded queue of text lines, for log output that must not grow without limit
+nor block the threads writing it.
+
+Any number of threads can push and pop at the same time without a lock (each
+slot carries a sequence number telling whether it is free or filled, see
+Dmitry Vyukov's bounded MPMC queue). When the ring is full the new line is
+dropped and counted: the writer never waits for the reader.
+
+Lines are stored in place, cut to lineSize characters, so pushing does not
+allocate.
+
+*/
+
+namespace Closedfish {
+
+class LogRing {
+public:
+	static constexpr size_t lineSize = 256;
+
+	/**
+	 * @brief Ring of at least capacity lines (rounded up to a power of two).
+	 */
+	explicit LogRing(size_t capacity = 1024);
+
+	LogRing(const LogRing &) = delete;
+	LogRing &operator=(const LogRing &) = delete;
+
+	/**
+	 * @brief Adds a line (without its end of line), cut to lineSize characters.
+	 *
+	 * @return false if the ring is full: the line is dropped.
+	 */
+	bool push(const char *text, size_t length);
+	bool push(const std::string &line) { return push(line.data(), line.size()); }
+
+	/**
+	 * @brief Takes the oldest line.
+	 *
+	 * @return false if the ring is empty.
+	 */
+	bool pop(std::string &line);
+
+	size_t capacity() const { return mask + 1; }
+
+	/**
+	 * @brief Lines dropped because the ring was full.
+	 */
+	uint64_t droppedLines() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+	struct Slot {
+		// == position while free for the push at position, position + 1 once
+		// filled for the pop at position
+		std::atomic<size_t> sequence;
+		size_t length;
+		char text[lineSize];
+	};
+
+	std::unique_ptr<Slot[]> slots;
+	size_t mask;
+	alignas(64) std::atomic<size_t> head; // position of the next push
+	alignas(64) std::atomic<size_t> tail; // position of the next pop
+	std::atomic<uint64_t> dropped;
+};
+
+} // namespace Closedfish
@@ -0,0 +1,83 @@
+#include "logger.h"
+#include <cstring>
+
+namespace Closedfish {
+Logger::LineSink::LineSink(LogRing &target) : ring(target) {
+	setp(buffer, buffer + sizeof buffer);
+}
+
+void Logger::LineSink::pushLines(bool full) {
+	char *start = pbase();
+	for (char *c = pbase(); c < pptr(); c++) {
+		if (*c == '\n') {
+			ring.push(start, c - start);
+			start = c + 1;
+		}
+	}
+	if (full && start == pbase()) {
+		// A line longer than the buffer is cut
+		ring.push(start, pptr() - start);
+		start = pptr();
+	}
+	size_t rest = pptr() - start;
+	memmove(buffer, start, rest);
+	setp(buffer, buffer + sizeof buffer);
+	pbump(int(rest));
+}
+
+int Logger::LineSink::overflow(int c) {
+	pushLines(true);
+	if (c != traits_type::eof()) {
+		*pptr() = traits_type::to_char_type(c);
+		pbump(1);
+	}
+	return traits_type::not_eof(c);
+}
+
+int Logger::LineSink::sync() {
+	pushLines(false);
+	return 0;
+}
+
+Logger::Logger(LogOutput outputMode, size_t ringCapacity)
+		: output(outputMode), ring(ringCapacity), coutSink(ring), loggerSink(ring),
+			originalCoutRdbuf(std::cout.rdbuf()) {
+	switch (output) {
+	case LogOutput::CONSOLE:
+		cout.rdbuf(originalCoutRdbuf);
+		break;
+	case LogOutput::RING:
+		std::cout.rdbuf(&coutSink);
+		cout.rdbuf(&loggerSink);
+		break;
+	case LogOutput::NONE:
+		// Without a buffer the streams are bad: << returns before formatting
+		std::cout.rdbuf(nullptr);
+		cout.rdbuf(nullptr);
+		break;
+	}
+}
+
+Logger::~Logger() {
+	if (output == LogOutput::RING) {
+		std::cout.flush();
+	}
+	// Also clears the bad state of NONE
+	std::cout.rdbuf(originalCoutRdbuf);
+}
+} // namespace Closedfish
+
+// Example for usage in main
+int main_example() {
+	Closedfish::Logger *logger =
+			new Closedfish::Logger(); // now std::cout goes to the logger's ring
+	std::cout << 60 << std::endl;
+	logger->cout << "Hello" << std::endl;
+	std::string line;
+	while (logger->popLine(line)) {
+		std::cerr << line << std::endl; // "60", then "Hello"
+	}
+	delete logger; // now std::cout is back
+	std::cout << "this should be fine" << std::endl;
+	return 0;
+}
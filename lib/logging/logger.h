@@ -0,0 +1,69 @@
+#pragma once
+#include <LogRing.h>
+#include <iostream>
+#include <streambuf>
+
+namespace Closedfish {
+
+/**
+ * @brief Where the text written by Stockfish (on std::cout) and to
+ * Logger::cout goes.
+ */
+enum class LogOutput {
+	CONSOLE, // printed, std::cout is left alone
+	RING,		 // kept line by line in the logger's ring, see Logger::popLine
+	NONE		 // discarded before being formatted
+};
+
+class Logger {
+private:
+	/**
+	 * @brief Stream buffer pushing every line written to it into a ring.
+	 */
+	class LineSink : public std::streambuf {
+	public:
+		explicit LineSink(LogRing &target);
+
+	protected:
+		int overflow(int c) override;
+		int sync() override;
+
+	private:
+		// Pushes the finished lines, and what is written so far if full
+		void pushLines(bool full);
+
+		LogRing &ring;
+		char buffer[LogRing::lineSize];
+	};
+
+	LogOutput output;
+	LogRing ring;
+	LineSink coutSink, loggerSink;
+	std::streambuf *originalCoutRdbuf;
+
+public:
+	std::ostream cout = std::ostream(nullptr); // text of Closedfish
+	/**
+	 * @brief Takes over std::cout, until destroyed, unless outputMode is
+	 * CONSOLE.
+	 *
+	 * @param ringCapacity : lines kept in RING mode before new ones are dropped.
+	 */
+	Logger(LogOutput outputMode = LogOutput::RING, size_t ringCapacity = 1024);
+	~Logger();
+
+	LogOutput getOutput() const { return output; }
+
+	/**
+	 * @brief Takes the oldest line kept in RING mode.
+	 *
+	 * @return false if there is none.
+	 */
+	bool popLine(std::string &line) { return ring.pop(line); }
+
+	/**
+	 * @brief Lines lost because the ring was full.
+	 */
+	uint64_t droppedLines() const { return ring.droppedLines(); }
+};
+} // namespace Closedfish
@@ -5,14 +5,20 @@
  *
  * @param cfb closedfish board
  * @param pos stockfish board
- * @param states stockfish statelist pointer
+ * @param states stockfish statelist pointer, reused if it already holds a
+ * list. Stockfish::Threads.start_thinking takes the list, so it is only
+ * reused between conversions that do not start a search.
  */
-void convert_CFBoard_to_Stockfish_Position(CFBoard cfb,
+void convert_CFBoard_to_Stockfish_Position(const CFBoard &cfb,
 																					 Stockfish::Position &pos,
 																					 Stockfish::StateListPtr &states) {
-	std::string fen = cfb.toFEN();
-	states = Stockfish::StateListPtr(new std::deque<Stockfish::StateInfo>(1));
-	pos.set(fen, false, &states->back(), Stockfish::Threads.main());
+	if (!states) {
+		states = Stockfish::StateListPtr(new std::deque<Stockfish::StateInfo>(1));
+	} else if (states->size() != 1) {
+		states->resize(1);
+	}
+	// Position::set clears the StateInfo before filling it
+	pos.set(stockfishFEN(cfb), false, &states->back(), Stockfish::Threads.main());
 }
 
 /**
@@ -6,8 +6,9 @@
 #define __builtin_clzll _lzcnt_u64
 #endif
 
-#include "logger.h"
+#include <logger.h>
 #include <CFBoard.h>
+#include <StockfishFEN.h>
 #include <stockfish/src/bitboard.h>
 #include <stockfish/src/endgame.h>
 #include <stockfish/src/position.h>
@@ -18,7 +19,7 @@
 #include <stockfish/src/tt.h>
 #include <stockfish/src/uci.h>
 
-void convert_CFBoard_to_Stockfish_Position(CFBoard cfb,
+void convert_CFBoard_to_Stockfish_Position(const CFBoard &cfb,
 																					 Stockfish::Position &pos,
 																					 Stockfish::StateListPtr &states);
 int parseAN(std::string str);
@@ -0,0 +1,92 @@
+#include "AttackMap.h"
+#include <AttackTables.h>
+
+namespace {
+
+struct CacheEntry {
+	PositionView position;
+	AttackMap map;
+	bool valid = false;
+};
+
+const int cacheSize = 256; // power of two
+
+struct Cache {
+	CacheEntry entries[cacheSize];
+	AttackMap::CacheStats stats;
+};
+
+thread_local Cache cache;
+
+// Tiles a piece of halfPieceId and color on tile attacks
+uint64_t pieceAttacks(int halfPieceId, bool color, int tile, uint64_t occupancy) {
+	switch (halfPieceId) {
+	case 0:
+		return AttackTables::pawnAttacks[color][tile];
+	case 1:
+		return AttackTables::knightAttacks[tile];
+	case 2:
+		return AttackTables::bishopAttacks(tile, occupancy);
+	case 3:
+		return AttackTables::rookAttacks(tile, occupancy);
+	case 4:
+		return AttackTables::bishopAttacks(tile, occupancy) | AttackTables::rookAttacks(tile, occupancy);
+	default:
+		return AttackTables::kingAttacks[tile];
+	}
+}
+
+} // namespace
+
+AttackMap::AttackMap() : attacks{} {
+	for (int color = 0; color < 2; color++) {
+		for (int tile = 0; tile < 64; tile++) {
+			counts[color][tile] = 0;
+			leastValuable[color][tile] = -1;
+		}
+	}
+}
+
+AttackMap::AttackMap(const PositionView &position) : AttackMap() {
+	uint64_t occupancy = position.occupancy();
+	for (int color = 0; color < 2; color++) {
+		// From the least valuable piece up, so the first attacker of a tile is
+		// the least valuable one
+		for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+			int pieceId = 2 * halfPieceId + color;
+			for (uint64_t pieces = position.pieces(pieceId); pieces; pieces &= pieces - 1) {
+				uint64_t attacked = pieceAttacks(halfPieceId, color, __builtin_ctzll(pieces), occupancy);
+				attacks[color] |= attacked;
+				for (; attacked; attacked &= attacked - 1) {
+					int tile = __builtin_ctzll(attacked);
+					if (counts[color][tile]++ == 0) {
+						leastValuable[color][tile] = static_cast<int8_t>(pieceId);
+					}
+				}
+			}
+		}
+	}
+}
+
+const AttackMap &AttackMap::get(const PositionView &position) {
+	uint64_t hash = position.getHash() * 0x9E3779B97F4A7C15ull;
+	CacheEntry &entry = cache.entries[(hash >> 32) & (cacheSize - 1)];
+	if (entry.valid && entry.position.samePieces(position)) {
+		cache.stats.hits++;
+		return entry.map;
+	}
+	cache.stats.misses++;
+	entry.position = position;
+	entry.map = AttackMap(position);
+	entry.valid = true;
+	return entry.map;
+}
+
+AttackMap::CacheStats AttackMap::getCacheStats() { return cache.stats; }
+
+void AttackMap::clearCache() {
+	for (CacheEntry &entry : cache.entries) {
+		entry.valid = false;
+	}
+	cache.stats = CacheStats();
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <PositionView.h>
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Every attack of a position, computed in one pass over the pieces: the tiles
+each color attacks, how many pieces of each color attack every tile, and the
+least valuable of them. Queries are then a lookup.
+
+AttackMap::get caches the maps per thread by the Zobrist key of the
+position (checked against the pieces), so the PieceMovements functions that
+ask about the same position many times only build its map once.
+
+Attacks are direct ones with the current occupancy: a slider does not see
+through the pieces in its way, whoever they belong to.
+
+*/
+
+class AttackMap {
+public:
+	/**
+	 * @brief Empty map, of a position without pieces.
+	 */
+	AttackMap();
+
+	/**
+	 * @brief Builds the map of position, without the cache.
+	 */
+	explicit AttackMap(const PositionView &position);
+
+	/**
+	 * @brief Map of position, from the cache of the calling thread when the same
+	 * pieces were looked up before.
+	 *
+	 * The reference points into that cache, without a copy: it is only valid
+	 * until the next get or clearCache of the same thread.
+	 */
+	static const AttackMap &get(const PositionView &position);
+
+	/**
+	 * @brief Tiles attacked by the pieces of color.
+	 */
+	uint64_t attackedBy(bool color) const { return attacks[color]; }
+
+	/**
+	 * @brief Tiles where a piece of color can be taken: the tiles attacked by the
+	 * opponent.
+	 */
+	uint64_t dangerousTiles(bool color) const { return attacks[!color]; }
+
+	bool isDangerous(bool color, int tile) const { return (attacks[!color] >> tile) & 1; }
+
+	/**
+	 * @brief Number of pieces of color attacking tile.
+	 */
+	int attackerCount(bool color, int tile) const { return counts[color][tile]; }
+
+	/**
+	 * @brief pieceId of the least valuable piece of color attacking tile (pawn,
+	 * knight, bishop, rook, queen, king), -1 if none.
+	 */
+	int leastValuableAttacker(bool color, int tile) const { return leastValuable[color][tile]; }
+
+	struct CacheStats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+	};
+
+	/**
+	 * @brief Cache statistics of the calling thread.
+	 */
+	static CacheStats getCacheStats();
+
+	/**
+	 * @brief Empties the cache of the calling thread and resets its statistics.
+	 */
+	static void clearCache();
+
+private:
+	uint64_t attacks[2];
+	int8_t counts[2][64];
+	int8_t leastValuable[2][64];
+};
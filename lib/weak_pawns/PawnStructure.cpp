@@ -0,0 +1,92 @@
+#include "PawnStructure.h"
+
+namespace PawnStructure {
+
+namespace {
+
+const uint64_t notFileA = ~0x0101010101010101ull;
+const uint64_t notFileH = ~0x8080808080808080ull;
+
+// One row forward for the pawns of color (white: towards tile 0)
+inline uint64_t forward(uint64_t board, bool color) {
+	return color ? board << 8 : board >> 8;
+}
+
+inline uint64_t backward(uint64_t board, bool color) {
+	return color ? board >> 8 : board << 8;
+}
+
+// Board and every tile in front of it
+uint64_t frontFill(uint64_t board, bool color) {
+	if (color) {
+		board |= board << 8;
+		board |= board << 16;
+		return board | board << 32;
+	}
+	board |= board >> 8;
+	board |= board >> 16;
+	return board | board >> 32;
+}
+
+uint64_t rearFill(uint64_t board, bool color) { return frontFill(board, !color); }
+
+inline uint64_t westOne(uint64_t board) { return (board >> 1) & notFileH; }
+
+inline uint64_t eastOne(uint64_t board) { return (board << 1) & notFileA; }
+
+// Attacks towards the a-file and towards the h-file
+inline uint64_t westAttacks(uint64_t pawns, bool color) {
+	return color ? (pawns << 7) & notFileH : (pawns >> 9) & notFileH;
+}
+
+inline uint64_t eastAttacks(uint64_t pawns, bool color) {
+	return color ? (pawns << 9) & notFileA : (pawns >> 7) & notFileA;
+}
+
+// Masks that only depend on the pawns of the side
+Side ownMasks(uint64_t pawns, bool color) {
+	Side side;
+	side.pawns = pawns;
+	uint64_t west = westAttacks(pawns, color);
+	uint64_t east = eastAttacks(pawns, color);
+	side.attacks = west | east;
+	side.doubleAttacks = west & east;
+	side.frontSpan = frontFill(forward(pawns, color), color);
+	side.attackSpan = frontFill(side.attacks, color);
+
+	uint64_t rearSpan = rearFill(backward(pawns, color), color);
+	uint64_t files = side.frontSpan | rearSpan | pawns;
+	side.protectedPawns = pawns & side.attacks;
+	side.connected = side.protectedPawns | (pawns & (westOne(pawns) | eastOne(pawns)));
+	side.isolated = pawns & ~(westOne(files) | eastOne(files));
+	side.doubled = pawns & (side.frontSpan | rearSpan);
+	return side;
+}
+
+// Masks that also depend on the opponent pawns
+void opponentMasks(Side &side, const Side &opponent, bool color) {
+	side.passed = side.pawns & ~(opponent.frontSpan | opponent.attackSpan);
+	uint64_t stops = forward(side.pawns, color);
+	side.backward = backward(stops & opponent.attacks & ~side.attackSpan, color);
+}
+
+} // namespace
+
+Structure analyze(uint64_t whitePawns, uint64_t blackPawns) {
+	Structure structure;
+	structure.sides[0] = ownMasks(whitePawns, 0);
+	structure.sides[1] = ownMasks(blackPawns, 1);
+	opponentMasks(structure.sides[0], structure.sides[1], 0);
+	opponentMasks(structure.sides[1], structure.sides[0], 1);
+	return structure;
+}
+
+Structure analyze(const PositionView &position) {
+	return analyze(position.pieces(0), position.pieces(1));
+}
+
+uint64_t pawnAttacks(uint64_t pawnBoard, bool color) {
+	return westAttacks(pawnBoard, color) | eastAttacks(pawnBoard, color);
+}
+
+} // namespace PawnStructure
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <PositionView.h>
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Set-wise analysis of the pawn structure: every mask is computed for all the
+pawns of a color at once, with shifts and masks only, instead of looking at
+the pawns one by one.
+
+Tiles follow the CFBoard convention (0: a8, 63: h1): white pawns move towards
+the lower tiles, black pawns towards the higher ones. "In front" always means
+in the moving direction of the pawns of the side.
+
+*/
+
+namespace PawnStructure {
+
+/**
+ * @brief Pawn masks of one color.
+ */
+struct Side {
+	uint64_t pawns;
+	uint64_t attacks;				 // tiles attacked by at least one pawn
+	uint64_t doubleAttacks;	 // tiles attacked by two pawns
+	uint64_t frontSpan;			 // tiles in front of the pawns, on their files
+	uint64_t attackSpan;		 // tiles the pawns attack now or after advancing
+	uint64_t protectedPawns; // pawns defended by a pawn (WeakPawns::isConnected)
+	uint64_t connected;			 // pawns defended by a pawn or with a pawn beside them
+	uint64_t isolated;			 // pawns with no pawn on the adjacent files
+	uint64_t doubled;				 // pawns with another pawn on their file
+	uint64_t passed;				 // pawns no opponent pawn can stop or capture
+	uint64_t backward;			 // pawns whose stop tile is attacked by an opponent
+													 // pawn and cannot be defended by a pawn
+};
+
+struct Structure {
+	Side sides[2]; // 0: white, 1: black
+};
+
+/**
+ * @brief Masks of both colors for the given pawns.
+ */
+Structure analyze(uint64_t whitePawns, uint64_t blackPawns);
+
+/**
+ * @brief Masks of both colors for the pawns of position.
+ */
+Structure analyze(const PositionView &position);
+
+/**
+ * @brief Tiles attacked by the pawns of pawnBoard, of the given color.
+ */
+uint64_t pawnAttacks(uint64_t pawnBoard, bool color);
+
+} // namespace PawnStructure
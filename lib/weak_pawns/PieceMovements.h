@@ -1,9 +1,19 @@
 #pragma once
 
+#include "AttackMap.h"
 #include "WeakPawns.h"
 
-uint64_t getDangerousTiles(CFBoard board, bool color);
-bool isTileDangerous(CFBoard board, bool color, int tile);
-int canPieceMoveOut(CFBoard &board, int tile);
-uint64_t *getPieceMovements(CFBoard &board, bool &color, int tile);
-int getLastMove(CFBoard lastBoard, CFBoard currentBoard, bool colorPlayed);
\ No newline at end of file
+/**
+ * @brief What a piece can do, see getPieceMovements.
+ */
+struct PieceMovements {
+	uint64_t direct;				// tiles the piece can move to
+	uint64_t afterMoveOut;	// ally pieces it protects that can move out of its way
+	uint64_t losses;				// the ones of afterMoveOut that can only move to a dangerous tile
+};
+
+uint64_t getDangerousTiles(const PositionView &position, bool color);
+bool isTileDangerous(const PositionView &position, bool color, int tile);
+int canPieceMoveOut(const PositionView &position, int tile);
+PieceMovements getPieceMovements(const PositionView &position, int tile);
+int getLastMove(const PositionView &lastPosition, const PositionView &currentPosition, bool colorPlayed);
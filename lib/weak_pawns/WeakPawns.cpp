@@ -1,4 +1,8 @@
 #include "WeakPawns.h"
+#include "PawnStructure.h"
+#include <AttackTables.h>
+#include <BitOperations.h>
+#include <limits>
 
 /*---DESCRIPTION---
 
@@ -25,98 +29,84 @@ To be used in blunder detection.
 We work under the assumption that if the opponents gets on the blunderBoard, he either gets eaten by one
 of our pawns, or eats one of our pawns but gets eaten after.
 
+- weakestPawnFiles : Files of the pawns of a color with the fewest protectors, as counted by nbProtectingPieces
+(used by DFS1P to pick the weak pawns of the heatmap). The pawn masks come from PawnStructure.
+
+Every function only reads a PositionView (a CFBoard can be passed directly): "what if this piece were gone"
+is answered with occupancy masks, never by removing pieces, so the functions can be called from several
+search threads at once.
+
 */
 
 using namespace std; 
 
-inline bool isPositionValid(const int &row, const int &col) {
-    return row >= 0 && row < 8 && col >= 0 && col < 8;
-}
-
 namespace WeakPawns{
 
+	namespace {
+
+		// Tiles a piece of boardId (1...5) on tile attacks, with the given occupancy
+		uint64_t pieceAttacks(int boardId, int tile, uint64_t occupancy){
+			switch(boardId){
+			case 1:
+				return AttackTables::knightAttacks[tile];
+			case 2:
+				return AttackTables::bishopAttacks(tile, occupancy);
+			case 3:
+				return AttackTables::rookAttacks(tile, occupancy);
+			case 4:
+				return AttackTables::bishopAttacks(tile, occupancy) | AttackTables::rookAttacks(tile, occupancy);
+			default:
+				return AttackTables::kingAttacks[tile];
+			}
+		}
+
+	}
+
 	/**
 	 * @brief Returns the number of pawns currenly protecting the piece at the target tile.
 	 *
-	 * @param board : current CFBoard
-	 * @param pTile : index of the tile to protect (0...63)
+	 * @param position : current position
+	 * @param tile : index of the tile to protect (0...63)
 	 * 
 	 * @return : number of protecting pawns 
 	 */
-	int nbProtectingPawns(CFBoard &board, int &pTile){
-
-		bool color = board.getPieceFromCoords(pTile)%2;
-		int pi = pTile/8;
-		int pj = pTile%8;
-		
-		int count = 0;
+	int nbProtectingPawns(const PositionView &position, int tile){
 
-		if(color){ //if black, we check if the two upper corners positions
-			if(isPositionValid(pi - 1 , pj - 1)){
-				int tile = (pi - 1)*8 + (pj - 1);
-				if (board.getBit(color,tile)){
-					count++;
-				}
-			}
-			if(isPositionValid(pi - 1 , pj + 1)){
-				int tile = (pi - 1)*8 + (pj + 1);
-				if (board.getBit(color, tile)){
-					count++;
-				}
-			}
-		}
-		else{ //if white, we check the two bottom corners positions
-			if(isPositionValid(pi + 1 , pj - 1)){
-				int tile = (pi + 1)*8 + (pj - 1);
-				if (board.getBit(color, tile)){
-					count++;
-				}
-			}
-			if(isPositionValid(pi + 1 , pj + 1)){
-				int tile = (pi + 1)*8 + (pj + 1);
-				if (board.getBit(color, tile)){
-					count++;
-				}
-			}
-		}
+		bool color = position.pieceAt(tile)%2;
 
-		return count;
+		//a pawn of color protects tile from where a pawn of the other color on tile would attack
+		return __builtin_popcountll(AttackTables::pawnAttacks[!color][tile] & position.pieces(color));
 
 	}
 
 	/**
 	 * @brief Returns the number of boardId currenly protecting the piece at the target tile
+	 * (the pieces that could legally take back on the tile)
 	 *
-	 * @param board : current CFBoard
-	 * @param pTile : index of the tile to protect (0...63)
+	 * @param position : current position
+	 * @param tile : index of the tile to protect (0...63)
 	 * @param boardId : equal to 0/1/2/3/4/5 for P/N/B/R/Q/K (piece_id >> 1)
 	 * 
 	 * @return : number of pieces of boardId protecting the target tile
 	 */
-	int nbProtectingPiecesById(CFBoard &board, int &pTile, int boardId){
+	int nbProtectingPiecesById(const PositionView &position, int tile, int boardId){
 
-		int pType  = board.getPieceFromCoords(pTile);
-		bool color = pType%2;
+		bool color = position.pieceAt(tile)%2;
 		
 		if(boardId == 0){ //if pawns, special case (since pawns move differently when they capture)
-			return nbProtectingPawns(board, pTile);
+			return nbProtectingPawns(position, tile);
 		}
 
 		int count = 0;
-		board.forceRemovePiece(pTile); //temporarly remove the piece to protect so the other pieces can get on the tile
-		uint64_t allyPieceBoard = board.getPieceBoardFromIndex(boardId) & board.getColorBitBoard(color);
+		//the sliders look through the piece to protect, as if it was already taken
+		uint64_t allyPieceBoard = pieceAttacks(boardId, tile, position.occupancy()) & position.pieces((boardId<<1) + color);
 
-		for (int tile = 0; tile <= 63; tile++){
-			if((allyPieceBoard & (1ll << tile))!= 0){ //we found an ally piece
-				uint64_t moves = board.getLegalMoves((boardId<<1) + color, tile); //get the moves that the ally piece can do
-				if(((moves)&(1ll<<pTile))!=0){//if the ally piece can do a move that reaches the tile to protect
-					count++;
-				}
+		for (int allyTile : setBits(allyPieceBoard)){ //an ally piece that reaches the tile
+			if(position.isMoveLegal(allyTile, tile)){ //if taking back does not leave the king in check
+				count++;
 			}
 		}
 
-		board.forceAddPiece(pType, pTile); //add the piece back
-
 		return count;
 
 	}
@@ -125,19 +115,17 @@ namespace WeakPawns{
 	 * @brief Returns the total number of pieces/pawns currenly protecting the piece at the target tile
 	 * (can be used to tell if any piece is protected)
 	 *
-	 * @param board : current CFBboard
+	 * @param position : current position
 	 * @param tile : index of the tile to protect
 	 * 
 	 * @return : number of protecting pieces/pawns 
 	 */
-	int nbProtectingPieces(CFBoard board, int tile){
-
-		bool color = board.getPieceFromCoords(tile)%2;
+	int nbProtectingPieces(const PositionView &position, int tile){
 
 		int count = 0;
 
 		for(int i = 0; i <= 5; i++){
-			count += nbProtectingPiecesById(board, tile, i);
+			count += nbProtectingPiecesById(position, tile, i);
 		}
 		return count;
 		
@@ -147,33 +135,27 @@ namespace WeakPawns{
 	 * @brief Tells whether the pawn at tile is connected or not
 	 * (if it is protected by at least 1 pawn)
 	 *
-	 * @param board : current CFBoard
+	 * @param position : current position
 	 * @param tile : index of the tile of the pawn (0...63)
 	 * 
 	 * @return : true or false
 	 */
-	bool isConnected(CFBoard &board, int &tile){
-		bool color = board.getPieceFromCoords(tile)%2;
-		if(nbProtectingPiecesById(board, tile, 0) > 0){ //boardId = color = 0 or 1
-			return true;
-		}
-		return false;
+	bool isConnected(const PositionView &position, int tile){
+		return nbProtectingPawns(position, tile) > 0;
 	}
 
 	/**
 	 * @brief Checks if a pawn is passed or not 
 	 * (if the colomn between the pawn and the opponent's side of the board if free)
 	 *
-	 * @param board : current CFBboard
+	 * @param position : current position
 	 * @param tile : index of tile of the pawn (0..63)
 	 * 
 	 * @return : true or false 
 	 */
-	bool isPassed(CFBoard &board, int &tile){
-
-		bool color = board.getPieceFromCoords(tile)%2;
-		uint64_t straight_line = board.getLegalMoves(6 + color, tile); // we imagine that the pawn in a rook
+	bool isPassed(const PositionView &position, int tile){
 
+		bool color = position.pieceAt(tile)%2;
 
 		int to_reach;
 		if(color){//if black, we go to the last row
@@ -183,61 +165,24 @@ namespace WeakPawns{
 			to_reach = tile%8;
 		}
 
-		if(straight_line & (1ll<<to_reach)){
-			return true;
+		//like a rook on the tile: nothing in between, and no ally piece on the last tile
+		if(to_reach == tile || (AttackTables::between[tile][to_reach] & position.occupancy())){
+			return false;
 		}
-		return false;
+		return !((position.colorPieces(color) >> to_reach) & 1);
 	}
 
 	/**
 	 * @brief Checks if a pawn is isolated (if there are no ally pieces/pawns on any of its adjacent tiles)
 	 *
-	 * @param board : current CFboard
+	 * @param position : current position
 	 * @param tile : index of tile of the pawn (0...63)
 	 * 
 	 * @return : true or false
 	 */
-	bool isIsolated(CFBoard &board, int &tile){ 
-		
-		bool color = board.getPieceFromCoords(tile)%2;
-		int count = 0; //counts the number of free tiles around 
-
-		//we imagine that we have a king on the tile and see where it can move
-		uint64_t free_nei_tiles = board.getLegalMoves(10+color, tile); 
-		//board.forceRemovePiece(tile);
-		//board.forceAddPiece(10+color, tile);
-		//std::cout<<board.getReprLegalMove(10+color, tile)<<std::endl;
-
-		for (int t = 0; t <= 63; t++){
-			if((free_nei_tiles & (1ll << t))){ 
-				std::cout<<t/8<<" "<<t%8<<std::endl;
-				count ++;
-			}
-		}
-
-
-
-		int pi = tile/8; //get index of the row
-		int pj = tile%8; //get the index of the column
-
-		if((pi == 0 && pj == 0) || (pi == 7 && pj == 7) || (pi == 0 && pj == 7) || (pi == 7 && pj == 0)){ //if we are on the corners
-			if(count == 3){ //only 3 free tiles are required
-				return true;
-			}
-		}
-		else{ //if we aren't on a corner
-			if(pi == 0 || pj == 0 || pi == 7 || pj == 7){ //if we are on a side
-				if(count == 5){ // we need 5 free tiles
-					return true;
-				}
-			}
-			else{ //if we are in the middle
-				if(count == 8){
-					return true;
-				}
-			}
-		}
-		return false;		
+	bool isIsolated(const PositionView &position, int tile){ 
+		bool color = position.pieceAt(tile)%2;
+		return !(AttackTables::kingAttacks[tile] & position.colorPieces(color));
 	}
 
 	/**
@@ -245,51 +190,17 @@ namespace WeakPawns{
 	 * by putting pawn on the "protecting tile"
 	 * (helper function for protectingTilesById)
 	 *
-	 * @param board : <CFBoard> current board
-	 * @param ptile : <int> index of the tile we want to protect
+	 * @param position : current position
+	 * @param tile : <int> index of the tile we want to protect
 	 * 
 	 * @return : bitboard
 	 */
-	uint64_t protectingTilesForPawns(CFBoard &board, int &pTile){
+	uint64_t protectingTilesForPawns(const PositionView &position, int tile){
 		
-		bool color = board.getPieceFromCoords(pTile)%2;
-		uint64_t result = 0;
-
-		int pi = pTile/8;
-		int pj = pTile%8;
-
-		int tile; 
-
-		if(color){ //if black, we check if the two upper corners positions
-			if(isPositionValid(pi - 1 , pj - 1)){
-				tile = (pi - 1)*8 + (pj - 1);
-				if (board.getPieceFromCoords(tile) == -1){ //if the position if free
-					result += (1ll << tile);
-				}
-			}
-			if(isPositionValid(pi - 1 , pj + 1)){
-				tile = (pi - 1)*8 + (pj + 1);
-				if (board.getPieceFromCoords(tile) == -1){ //if the position if free
-					result += (1ll << tile);
-				}
-			}
+		bool color = position.pieceAt(tile)%2;
 
-		}else{ //if white, we check the two bottom corners positions
-			if(isPositionValid(pi + 1 , pj - 1)){
-				tile = (pi + 1)*8 + (pj - 1);
-				if (board.getPieceFromCoords(tile) == -1){ //if the position if free
-					result += (1ll << tile);
-				}
-			}
-			if(isPositionValid(pi + 1 , pj + 1)){
-				tile = (pi + 1)*8 +  (pj + 1);
-				if (board.getPieceFromCoords(tile) == -1){ //if the position if free
-					result += (1ll << tile);
-				}
-			}
-		}
-
-		return result;
+		//the free tiles from where a pawn of color attacks tile
+		return AttackTables::pawnAttacks[!color][tile] & ~position.occupancy();
 	}
 
 	/**
@@ -297,48 +208,39 @@ namespace WeakPawns{
 	 * by putting a piece of BoardId on the "protecting tile"
 	 * (helper function for prTiles)
 	 * 
-	 * @param board : current CFBboard
-	 * @param pTile : index of the tile we want to protect (0...63)
+	 * @param position : current position
+	 * @param tile : index of the tile we want to protect (0...63)
 	 * @param boardId : equal to 0/1/2/3/4/5 for P/N/B/R/Q/K (piece_id >> 1)
 	 * 
 	 * @return: bitboard
 	 */
-	uint64_t protectingTilesForId(CFBoard &board, int pTile, int boardId){
+	uint64_t protectingTilesForId(const PositionView &position, int tile, int boardId){
 		
-		int color = board.getPieceFromCoords(pTile)%2;
-		uint64_t result = 0;
+		bool color = position.pieceAt(tile)%2;
 
 		if(boardId == 0){ //if pawn
-			return protectingTilesForPawns(board, pTile);
+			return protectingTilesForPawns(position, tile);
 		}
 
-		// we imagine we have a piece_id on the tile
-		uint64_t moves = board.getLegalMoves((boardId<<1) + color, pTile); 
-		for (int tile = 0; tile <= 63; tile++){
-			if((moves & (1ll << tile)) != 0){ 
-				result += (1ll << tile);
-			}
-		}
-
-		return result;
+		// we imagine we have a piece of boardId on the tile
+		return pieceAttacks(boardId, tile, position.occupancy()) & ~position.colorPieces(color);
 	}
 	
 	/**
 	 * @brief Returns a bit board with 1s on the tiles that can protect the piece at tile
 	 * (if we can get one of the ally pieces on one of the "protecting tiles", then we will protect the target tile)
 	 *
-	 * @param board : current CFBboard
+	 * @param position : current position
 	 * @param tile : index of the tile we want to protect (0...63)
 	 * 
 	 * @return: bitboard
 	 */
-	uint64_t protectingTiles(CFBoard &board, int tile){
+	uint64_t protectingTiles(const PositionView &position, int tile){
 		
-		bool color = board.getPieceFromCoords(tile)%2;
 		uint64_t result = 0; //output bitboard
 
 		for(int i = 0; i<=5; i++){
-			result = result | protectingTilesForId(board,tile, i);
+			result = result | protectingTilesForId(position, tile, i);
 		}
 
 		return result;	
@@ -353,9 +255,8 @@ namespace WeakPawns{
 	 * 
 	 * @return: string
 	 */
-	string ReprProtectingTiles(CFBoard board, int tile){
+	string ReprProtectingTiles(const CFBoard &board, int tile){
 		
-		bool color = board.getPieceFromCoords(tile)%2;
 		uint64_t proTiles = protectingTiles(board, tile);
 		std::string repr = "|";
 		bool isProtectingTile; //0 or 1
@@ -389,51 +290,13 @@ namespace WeakPawns{
 	/**
 	 * @brief Returns the bitboard of the tiles protected by pawns 
 	 *
-	 * @param board : current CFBboard
+	 * @param position : current position
 	 * @param color : white : 0, black : 1
 	 * 
 	 * @return: bitboard (uint64_t)
 	 */
-	uint64_t getBoardProtectedByPawns(CFBoard board, bool color){
-
-		uint64_t pawnBoard = board.getPieceBoardFromIndex(0) & board.getPieceColorBitBoard(color);
-		uint64_t res = 0ll;
-
-		for(int t = 0; t<=63; t++){
-			if((1ll<<t)&pawnBoard){ //found an ally pawn
-				
-				//get the cartesian coords of the pawn
-				int pi = t/8;
-				int pj = t%8;
-				
-				
-				if(color == 0){ //if white, we check if the two upper corners positions
-					if(isPositionValid(pi - 1 , pj - 1)){ //upper left
-						int tile = (pi - 1)*8 + (pj - 1);
-						// std::cerr << "upper left white " << tile << '\n';
-						res |= (1ll<<tile);
-					}
-					if(isPositionValid(pi - 1 , pj + 1)){ //upper right
-						int tile = (pi - 1)*8 + (pj + 1);
-						// std::cerr << "upper right white " << tile << '\n';
-						res |= (1ll<<tile);
-					}
-				}
-				else{ //if black, we check the two bottom corners positions
-					if(isPositionValid(pi + 1 , pj - 1)){
-						int tile = (pi + 1)*8 + (pj - 1);
-						res |= (1ll<<tile);
-					}
-					if(isPositionValid(pi + 1 , pj + 1)){
-						int tile = (pi + 1)*8 + (pj + 1);
-						res |= (1ll<<tile);
-					}
-				}
-					
-			}
-		}
-
-		return res;
+	uint64_t getBoardProtectedByPawns(const PositionView &position, bool color){
+		return PawnStructure::pawnAttacks(position.pieces(color), color);
 	}
 
 	/**
@@ -442,13 +305,13 @@ namespace WeakPawns{
 	 * 
 	 * !!! to be computed BEFORE the opponent's move !!!
 	 *
-	 * @param board : current CFBboard
+	 * @param position : current position
 	 * @param color : ally color 0 or 1
 	 * 
 	 * @return: string
 	 */
-	uint64_t blunderBoard(CFBoard board, bool color){
-		return getBoardProtectedByPawns(board, color) & (board.getPieceBoardFromIndex(0) & board.getColorBitBoard(color));
+	uint64_t blunderBoard(const PositionView &position, bool color){
+		return getBoardProtectedByPawns(position, color) & position.pieces(color);
 	}
 
 	/**
@@ -459,7 +322,7 @@ namespace WeakPawns{
 	 * 
 	 * @return: string
 	 */
-	string ReprProtectedByPawn(CFBoard board, bool color){
+	string ReprProtectedByPawn(const CFBoard &board, bool color){
 		
 		uint64_t protByPawns = getBoardProtectedByPawns(board, color);
 		std::string repr = "|";
@@ -491,4 +354,43 @@ namespace WeakPawns{
 		return repr;
 	}
 
+	/**
+	 * @brief Returns the files of the pawns of color with the fewest protectors, the count of
+	 * nbProtectingPieces: the pawn protectors come from the pawn structure, the other pieces
+	 * from the attacks to the tile of the pawn, when taking back is legal
+	 *
+	 * @param position : current position
+	 * @param color : color of the pawns, 0 or 1
+	 * 
+	 * @return : bitboard of the files (bit i for the file i) of the weakest pawns
+	 */
+	uint64_t weakestPawnFiles(const PositionView &position, bool color){
+
+		PawnStructure::Side pawns = PawnStructure::analyze(position).sides[color];
+		uint64_t occupancy = position.occupancy();
+		uint64_t pieces = position.colorPieces(color) & ~pawns.pawns;
+
+		uint64_t weakFiles = 0;
+		int fewestProtectors = std::numeric_limits<int>::max();
+		for (int tile : setBits(pawns.pawns)){
+			int count = static_cast<int>(((pawns.attacks >> tile) & 1) + ((pawns.doubleAttacks >> tile) & 1));
+
+			for (int pieceTile : setBits(position.attackersTo(tile, occupancy) & pieces)){
+				if(position.isMoveLegal(pieceTile, tile)){
+					count++;
+				}
+			}
+
+			if(count < fewestProtectors){
+				fewestProtectors = count;
+				weakFiles = 0;
+			}
+			if(count == fewestProtectors){
+				weakFiles |= 1ull << (tile % 8);
+			}
+		}
+
+		return weakFiles;
+	}
+
 }
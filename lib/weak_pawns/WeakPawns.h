@@ -1,21 +1,23 @@
 #pragma once
 
 #include <CFBoard.h>
+#include <PositionView.h>
 #include <string>
 #include <vector>
 
 namespace WeakPawns {
-int nbProtectingPawns(CFBoard &board, int &pTile);
-int nbProtectingPiecesById(CFBoard &board, int &pTile, int boardId);
-int nbProtectingPieces(CFBoard board, int tile);
-bool isConnected(CFBoard &board, int &tile);
-bool isPassed(CFBoard &board, int &tile);
-bool isIsolated(CFBoard &board, int &tile);
-uint64_t protectingTilesForPawns(CFBoard &board, int &pTile);
-uint64_t protectingTilesForId(CFBoard &board, int pTile, int boardId);
-uint64_t protectingTiles(CFBoard &board, int tile);
-std::string ReprProtectingTiles(CFBoard board, int tile);
-uint64_t getBoardProtectedByPawns(CFBoard board, bool color);
-uint64_t blunderBoard(CFBoard board, bool color);
-std::string ReprProtectedByPawn(CFBoard board, bool color);
-}
\ No newline at end of file
+int nbProtectingPawns(const PositionView &position, int tile);
+int nbProtectingPiecesById(const PositionView &position, int tile, int boardId);
+int nbProtectingPieces(const PositionView &position, int tile);
+bool isConnected(const PositionView &position, int tile);
+bool isPassed(const PositionView &position, int tile);
+bool isIsolated(const PositionView &position, int tile);
+uint64_t protectingTilesForPawns(const PositionView &position, int tile);
+uint64_t protectingTilesForId(const PositionView &position, int tile, int boardId);
+uint64_t protectingTiles(const PositionView &position, int tile);
+std::string ReprProtectingTiles(const CFBoard &board, int tile);
+uint64_t getBoardProtectedByPawns(const PositionView &position, bool color);
+uint64_t blunderBoard(const PositionView &position, bool color);
+std::string ReprProtectedByPawn(const CFBoard &board, bool color);
+uint64_t weakestPawnFiles(const PositionView &position, bool color);
+}
@@ -1,6 +1,11 @@
 #include "ClosedfishConnect.h"
 
 Closedfish::Move ClosedfishEngine::getNextMove() {
-	// to be completed by @algo.
-	return {0, 0, 0.0};
-}
\ No newline at end of file
+	search.setBoardPointer(currentBoard);
+	return search.getNextMove();
+}
+
+void ClosedfishEngine::setSearchLimits(const Closedfish::SearchLimits &limits) {
+	ChessEngine::setSearchLimits(limits);
+	search.setSearchLimits(limits);
+}
@@ -1,9 +1,21 @@
 #pragma once
+#include <DFS1P.h>
 #include <EngineWrapper.h>
 #include <tuple>
 
+/**
+ * @brief The engine of closed positions: a DFS1P search on the current board.
+ */
 class ClosedfishEngine : public Closedfish::ChessEngine {
 public:
 	ClosedfishEngine() : ChessEngine() {}
+
+	/**
+	 * @brief Next move of the DFS1P search, start == end if it found none.
+	 */
 	Closedfish::Move getNextMove();
-};
\ No newline at end of file
+	void setSearchLimits(const Closedfish::SearchLimits &limits);
+
+private:
+	DFS1P search;
+};
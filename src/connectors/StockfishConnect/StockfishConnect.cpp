@@ -1,48 +1,262 @@
 #include "StockfishConnect.h"
+#include <stockfish/src/movegen.h>
 
-// look at uci.cpp for reference
-std::string call_stockfish(Stockfish::Position &pos,
-													 Stockfish::StateListPtr &states,
-													 Stockfish::Search::LimitsType limits,
-													 bool ponderMode, Closedfish::Logger *logger) {
-	auto &cout = logger ? logger->cout : std::cerr;
-	cout << "Calling Stockfish" << std::endl;
-	limits.time[Stockfish::WHITE] = limits.time[Stockfish::BLACK] =
-			Stockfish::TimePoint(1000);
+namespace {
+
+/**
+ * @brief CFBoard tile of a Stockfish square: Stockfish counts from a1, CFBoard
+ * from a8.
+ */
+int toTile(Stockfish::Square square) { return square ^ 56; }
+
+/**
+ * @brief CFBoard start and end tiles of move.
+ */
+std::pair<int, int> moveTiles(Stockfish::Move move) {
+	Stockfish::Square from = Stockfish::from_sq(move), to = Stockfish::to_sq(move);
+	// Castling is stored as the king taking its own rook
+	if (Stockfish::type_of(move) == Stockfish::CASTLING) {
+		to = Stockfish::make_square(to > from ? Stockfish::FILE_G : Stockfish::FILE_C,
+																Stockfish::rank_of(from));
+	}
+	return {toTile(from), toTile(to)};
+}
+
+/**
+ * @brief limits with a budget (one second if it has none) and started now.
+ */
+Stockfish::Search::LimitsType finiteLimits(Stockfish::Search::LimitsType limits) {
+	// An infinite search only stops on "stop", which nobody sends here
+	limits.infinite = 0;
+	if (!limits.depth && !limits.nodes && !limits.movetime && !limits.mate &&
+			!limits.use_time_management()) {
+		limits.movetime = Stockfish::TimePoint(1000);
+	}
 	limits.startTime = Stockfish::now();
-	Stockfish::Threads.start_thinking(pos, states, limits, ponderMode);
-	std::string line;
-	// wait for stockfish threads to finish
-	std::this_thread::sleep_until(std::chrono::system_clock::now() +
-																std::chrono::seconds(1));
+	return limits;
+}
+
+/**
+ * @brief Waits for the running search to stop and reads its result.
+ *
+ * @param pv : if not null, receives the principal variation.
+ */
+StockfishResult finishSearch(std::vector<Stockfish::Move> *pv = nullptr) {
+	// The main thread stops the helpers and returns once the budget is spent
+	Stockfish::Threads.main()->wait_for_search_finished();
+
+	Stockfish::Thread *bestThread = Stockfish::Threads.get_best_thread();
+	const Stockfish::Search::RootMove &rootMove = bestThread->rootMoves[0];
+	if (pv) {
+		*pv = rootMove.pv;
+	}
+	StockfishResult result;
+	result.depth = bestThread->completedDepth;
+	result.nodes = Stockfish::Threads.nodes_searched();
+	Stockfish::Move move = rootMove.pv[0];
+	float score = float(rootMove.score) / Stockfish::PawnValueEg;
+	if (move == Stockfish::MOVE_NONE) {
+		CF_LOG_WARNING("Stockfish has no move");
+		result.move = {0, 0, score};
+		return result;
+	}
+	for (Stockfish::Move pvMove : rootMove.pv) {
+		result.pv.push_back(moveTiles(pvMove));
+	}
+	auto [from, to] = result.pv[0];
+	result.move = {from, to, score};
+	CF_LOG_INFO("Stockfish: ", toAN(from), toAN(to), " depth ", result.depth,
+							" nodes ", result.nodes);
+	return result;
+}
+
+/**
+ * @brief Pieces and player of a FEN, the fields Stockfish always keeps as
+ * given (it drops the castling rights and en passant tiles it cannot use).
+ */
+std::string piecesAndPlayer(const std::string &fen) {
+	return fen.substr(0, fen.find(' ', fen.find(' ') + 1));
+}
+
+} // namespace
+
+// look at uci.cpp for reference
+StockfishResult call_stockfish(Stockfish::Position &pos,
+															 Stockfish::StateListPtr &states,
+															 Stockfish::Search::LimitsType limits) {
+	CF_LOG_DEBUG("Calling Stockfish");
+	Stockfish::Threads.start_thinking(pos, states, finiteLimits(limits), false);
+	return finishSearch();
+}
+
+void StockfishSession::setOptions(const Options &newOptions) {
+	stopPondering();
+	// Through the UCI options, so Stockfish resizes what depends on them
+	if (newOptions.hashSize != options.hashSize) {
+		Stockfish::Options["Hash"] = std::to_string(newOptions.hashSize);
+	}
+	if (newOptions.threads != options.threads) {
+		Stockfish::Options["Threads"] = std::to_string(newOptions.threads);
+		// The position points to the main thread, which was replaced
+		states.reset();
+	}
+	options = newOptions;
+}
+
+void StockfishSession::setPosition(const CFBoard &board) {
+	stopPondering();
+	startFEN = stockfishFEN(board);
+	moves.clear();
+	bestMove = expectedAnswer = Stockfish::MOVE_NONE;
+	replayGame();
+}
+
+void StockfishSession::replayGame() {
+	// The same as the "position fen ... moves ..." UCI command
+	states = Stockfish::StateListPtr(new std::deque<Stockfish::StateInfo>(1));
+	pos.set(startFEN, false, &states->back(), Stockfish::Threads.main());
+	for (Stockfish::Move move : moves) {
+		states->emplace_back();
+		pos.do_move(move, states->back());
+	}
+}
+
+bool StockfishSession::isAt(const CFBoard &board) {
+	if (startFEN.empty()) {
+		return false;
+	}
+	if (!states) {
+		replayGame();
+	}
+	return piecesAndPlayer(pos.fen()) == piecesAndPlayer(stockfishFEN(board));
+}
+
+Stockfish::Move StockfishSession::findMove(int startTile, int endTile) {
+	for (const Stockfish::ExtMove &move : Stockfish::MoveList<Stockfish::LEGAL>(pos)) {
+		// CFBoard promotes to a queen
+		if (Stockfish::type_of(move) == Stockfish::PROMOTION &&
+				Stockfish::promotion_type(move) != Stockfish::QUEEN) {
+			continue;
+		}
+		if (moveTiles(move) == std::make_pair(startTile, endTile)) {
+			return move;
+		}
+	}
+	return Stockfish::MOVE_NONE;
+}
+
+bool StockfishSession::doMove(int startTile, int endTile) {
+	if (startFEN.empty()) {
+		return false;
+	}
+	if (!states) {
+		replayGame();
+	}
+	Stockfish::Move move = findMove(startTile, endTile);
+	if (move == Stockfish::MOVE_NONE) {
+		return false;
+	}
+	if (pondering) {
+		if (move == expectedAnswer && !ponderHit) {
+			ponderHit = true; // the search running is the one on this position
+		} else {
+			stopPondering();
+		}
+	}
+	moves.push_back(move);
+	states->emplace_back();
+	pos.do_move(move, states->back());
+
+	// The move the last search advised was played: the opponent thinks now
+	if (options.ponder && move == bestMove && expectedAnswer != Stockfish::MOVE_NONE) {
+		startPondering();
+	}
+	bestMove = Stockfish::MOVE_NONE;
+	return true;
+}
+
+void StockfishSession::startPondering() {
+	// The search gets its own state list, with the expected answer played
+	Stockfish::Position ponderPos;
+	Stockfish::StateListPtr ponderStates(new std::deque<Stockfish::StateInfo>(1));
+	ponderPos.set(startFEN, false, &ponderStates->back(), Stockfish::Threads.main());
+	for (Stockfish::Move move : moves) {
+		ponderStates->emplace_back();
+		ponderPos.do_move(move, ponderStates->back());
+	}
+	if (!ponderPos.pseudo_legal(expectedAnswer) || !ponderPos.legal(expectedAnswer)) {
+		return;
+	}
+	ponderStates->emplace_back();
+	ponderPos.do_move(expectedAnswer, ponderStates->back());
+	Stockfish::Threads.start_thinking(ponderPos, ponderStates, finiteLimits(lastLimits), true);
+	pondering = true;
+	ponderHit = false;
+}
+
+void StockfishSession::stopPondering() {
+	if (!pondering) {
+		return;
+	}
 	Stockfish::Threads.stop = true;
-	if (!logger) {
-		cout << "Done" << std::endl;
-		return "";
-	}
-	while (getline(logger->stream, line)) {
-		std::stringstream lstream(line);
-		std::string cmd;
-		lstream >> cmd;
-		cout << "[LINE] " << line << std::endl;
-		if (cmd == "bestmove") {
-			std::string bestmove;
-			lstream >> bestmove;
-			return bestmove;
+	Stockfish::Threads.main()->wait_for_search_finished();
+	pondering = ponderHit = false;
+}
+
+void StockfishSession::stopSearch() { Stockfish::Threads.stop = true; }
+
+StockfishResult StockfishSession::search(Stockfish::Search::LimitsType limits) {
+	lastLimits = limits;
+	if (pondering && ponderHit) {
+		// The search started on the opponent's time goes on as a normal one
+		CF_LOG_DEBUG("Stockfish ponder hit");
+		Stockfish::Threads.main()->ponder = false;
+	} else {
+		stopPondering();
+		if (!states) {
+			replayGame();
 		}
+		CF_LOG_DEBUG("Calling Stockfish");
+		// Takes states: replayGame gives the session a new list afterwards
+		Stockfish::Threads.start_thinking(pos, states, finiteLimits(limits), false);
 	}
-	cout << "bestmove not found" << std::endl;
-	return "bestmove not found";
+	pondering = ponderHit = false;
+	// Stopped before start_thinking cleared the stop signal
+	if (stopFlag && *stopFlag) {
+		stopSearch();
+	}
+
+	std::vector<Stockfish::Move> pv;
+	StockfishResult result = finishSearch(&pv);
+	bestMove = pv.empty() ? Stockfish::MOVE_NONE : pv[0];
+	expectedAnswer = pv.size() > 1 ? pv[1] : Stockfish::MOVE_NONE;
+	return result;
 }
 
 Closedfish::Move StockfishEngine::getNextMove() {
-	Stockfish::Position pos;
-	Stockfish::StateListPtr states;
-	convert_CFBoard_to_Stockfish_Position(*currentBoard, pos, states);
-	std::string out = call_stockfish(pos, states, {}, false, logger);
-	if (out.size() != 4) {
+	if (!session.isAt(*currentBoard)) {
+		session.setPosition(*currentBoard);
+	}
+	Stockfish::Search::LimitsType limits = stockfishLimits;
+	if (!limits.depth && !limits.nodes && !limits.movetime) {
+		if (searchLimits.maxTime > 0) {
+			limits.movetime = Stockfish::TimePoint(searchLimits.maxTime * 1000);
+		}
+		limits.nodes = searchLimits.maxNodes;
+	}
+	StockfishResult result = session.search(limits);
+	if (observer) {
+		observer->onSearchFinished(result);
+	}
+	if (std::get<0>(result.move) == std::get<1>(result.move)) {
 		throw "Stockfish invalid output";
 	}
-	return {parseAN(out.substr(0, 2)), parseAN(out.substr(2, 2)),
-					0.0}; // todo: parse from out
-}
\ No newline at end of file
+	return result.move;
+}
+
+void StockfishEngine::processMove(Closedfish::Move move) {
+	ChessEngine::processMove(move);
+	if (!session.doMove(std::get<0>(move), std::get<1>(move))) {
+		session.setPosition(*currentBoard);
+	}
+}
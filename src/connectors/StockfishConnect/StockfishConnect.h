@@ -1,11 +1,141 @@
 #pragma once
 #include <EngineWrapper.h>
+#include <Log.h>
+#include <atomic>
 #include <tuple>
 #include <utils.h>
+#include <vector>
+
+/**
+ * @brief Result of a finished Stockfish search.
+ */
+struct StockfishResult {
+	Closedfish::Move move; // tiles in the CFBoard convention, score in pawns for
+												 // the side to move; start == end if there is no move
+	int depth;						 // last depth Stockfish completed
+	uint64_t nodes;				 // positions searched by all the threads
+	// Principal variation, as (start, end) tiles, starting with move
+	std::vector<std::pair<int, int>> pv;
+};
+
+/**
+ * @brief Receives the results of the searches of a StockfishEngine as they
+ * finish, as data rather than text.
+ */
+class SearchObserver {
+public:
+	virtual ~SearchObserver() = default;
+	virtual void onSearchFinished(const StockfishResult &result) = 0;
+};
+
+/**
+ * @brief Runs a Stockfish search on pos and blocks until it stops by itself.
+ *
+ * @param limits : budget of the search (depth, nodes, movetime, clock...). A
+ * search without any budget would never stop: it then gets one second.
+ */
+StockfishResult call_stockfish(Stockfish::Position &pos,
+															 Stockfish::StateListPtr &states,
+															 Stockfish::Search::LimitsType limits);
+
+/**
+ * @brief A game followed by Stockfish from one search to the next.
+ *
+ * The session keeps the position the game started from and every move played
+ * since, so Stockfish sees the repetitions, and it never clears the
+ * transposition table: a search starts with what the previous ones found.
+ * With pondering on, Stockfish keeps searching while the opponent thinks, on
+ * the answer it expects; if that answer is played, the next search goes on
+ * from there.
+ *
+ * Stockfish has a single thread pool and table, so there should be only one
+ * session at a time.
+ */
+class StockfishSession {
+public:
+	struct Options {
+		size_t hashSize = 16; // transposition table, in MB
+		size_t threads = 1;
+		bool ponder = false;
+	};
+
+	StockfishSession() = default;
+	~StockfishSession() { stopPondering(); }
+
+	/**
+	 * @brief Resizes the table and the thread pool of Stockfish (a resize
+	 * empties the table).
+	 */
+	void setOptions(const Options &newOptions);
+	const Options &getOptions() const { return options; }
+
+	/**
+	 * @brief Starts a new game from board, forgetting the moves played before.
+	 */
+	void setPosition(const CFBoard &board);
+
+	/**
+	 * @brief Whether the session is at the same pieces and player as board.
+	 */
+	bool isAt(const CFBoard &board);
+
+	/**
+	 * @brief Plays the move from startTile to endTile (queen for promotions).
+	 *
+	 * @return false if the session has no position yet or the move is not
+	 * legal in it; the session is then left as it was.
+	 */
+	bool doMove(int startTile, int endTile);
+
+	/**
+	 * @brief Searches the current position with the budget of limits (see
+	 * call_stockfish) and blocks until the search is over.
+	 */
+	StockfishResult search(Stockfish::Search::LimitsType limits);
+
+	void stopPondering();
+	bool isPondering() const { return pondering; }
+
+	/**
+	 * @brief Flag another thread sets, before calling stopSearch, to end the
+	 * searches early; nullptr for none (the default). Not owned.
+	 *
+	 * Stockfish clears its own stop signal when a search starts: a stopSearch
+	 * that comes before is only seen through this flag.
+	 */
+	void setStopFlag(const std::atomic<bool> *flag) { stopFlag = flag; }
+
+	/**
+	 * @brief Ends the running search, from any thread: search then returns the
+	 * best move of the depths Stockfish finished.
+	 */
+	static void stopSearch();
+
+private:
+	// Sets pos up again from the start of the game, in a new state list
+	void replayGame();
+	Stockfish::Move findMove(int startTile, int endTile);
+	void startPondering();
+
+	Options options;
+	std::string startFEN; // empty before setPosition
+	std::vector<Stockfish::Move> moves;
+	Stockfish::Position pos;
+	// Taken by Stockfish for every search, then rebuilt by replayGame
+	Stockfish::StateListPtr states;
+
+	// Move advised by the last search and the answer it expects
+	Stockfish::Move bestMove = Stockfish::MOVE_NONE;
+	Stockfish::Move expectedAnswer = Stockfish::MOVE_NONE;
+	Stockfish::Search::LimitsType lastLimits;
+	bool pondering = false;
+	bool ponderHit = false; // the expected answer was played
+	const std::atomic<bool> *stopFlag = nullptr;
+};
 
 class StockfishEngine : public Closedfish::ChessEngine {
 public:
-	StockfishEngine() : ChessEngine() {}
+	StockfishEngine() : ChessEngine(), logger(nullptr) {}
 	/**
 	 * @brief Construct a new Stockfish Engine object
 	 *
@@ -15,6 +145,42 @@ public:
 	StockfishEngine(Closedfish::Logger *logger) : logger(logger), ChessEngine() {}
 	Closedfish::Move getNextMove();
 
+	/**
+	 * @brief Makes the move on the current board and in the Stockfish session.
+	 */
+	void processMove(Closedfish::Move move);
+
+	/**
+	 * @brief Budget given as is to the next Stockfish searches. Without a depth,
+	 * node or movetime limit, the maxTime and maxNodes of setSearchLimits are
+	 * used instead (maxDepth counts Closedfish moves, not Stockfish plies, and
+	 * is not used).
+	 */
+	void setStockfishLimits(const Stockfish::Search::LimitsType &limits) {
+		stockfishLimits = limits;
+	}
+
+	/**
+	 * @brief Hash size, threads and pondering of the Stockfish session.
+	 */
+	void setSessionOptions(const StockfishSession::Options &options) {
+		session.setOptions(options);
+	}
+
+	/**
+	 * @brief Observer told about every search, nullptr for none. Not owned.
+	 */
+	void setObserver(SearchObserver *newObserver) { observer = newObserver; }
+
+	/**
+	 * @brief See StockfishSession::setStopFlag and stopSearch.
+	 */
+	void setStopFlag(const std::atomic<bool> *flag) { session.setStopFlag(flag); }
+	void stopSearch() { StockfishSession::stopSearch(); }
+
 private:
 	Closedfish::Logger *logger;
-};
\ No newline at end of file
+	Stockfish::Search::LimitsType stockfishLimits;
+	StockfishSession session;
+	SearchObserver *observer = nullptr;
+};
@@ -0,0 +1,57 @@
+#include "ClosenessClassifier.h"
+
+namespace {
+
+// Trained once for every classifier
+const Eigen::VectorXd &trainedTheta() {
+	static const Eigen::VectorXd theta = EvaluationFunction::getTheta();
+	return theta;
+}
+
+} // namespace
+
+ClosenessClassifier::ClosenessClassifier()
+		: basis(SqrtDifBasis::GenerateBasis()), theta(trainedTheta()) {}
+
+ClosenessClassifier::~ClosenessClassifier() { delete[] basis; }
+
+void ClosenessClassifier::pawnRows(uint64_t whitePawns, uint64_t blackPawns,
+																	 int (&top)[8], int (&bottom)[8]) {
+	const uint64_t column = 0x0101010101010101ull;
+	for (int col = 0; col < 8; col++) {
+		uint64_t black = blackPawns & (column << col);
+		uint64_t white = whitePawns & (column << col);
+		// Black pawns move towards row 7, white pawns towards row 0
+		top[col] = black ? (63 - __builtin_clzll(black)) >> 3 : 8;
+		bottom[col] = white ? __builtin_ctzll(white) >> 3 : -1;
+	}
+}
+
+float ClosenessClassifier::score(const CFBoard &board) {
+	uint64_t pawns = board.getPieceBoardFromIndex(0);
+	uint64_t whitePawns = pawns & board.getColorBitBoard(0);
+	uint64_t blackPawns = pawns & board.getColorBitBoard(1);
+	uint64_t hash = board.getPawnHash() * 0x9E3779B97F4A7C15ull;
+	CacheEntry &entry = cache[(hash >> 32) & (cacheSize - 1)];
+	if (entry.valid && entry.whitePawns == whitePawns && entry.blackPawns == blackPawns) {
+		stats.hits++;
+		return entry.score;
+	}
+	stats.misses++;
+
+	int top[8], bottom[8];
+	pawnRows(whitePawns, blackPawns, top, bottom);
+	entry.whitePawns = whitePawns;
+	entry.blackPawns = blackPawns;
+	entry.score = EvaluationFunction::Evaluate(basis, theta, top, bottom, dimension);
+	entry.valid = true;
+	return entry.score;
+}
+
+bool ClosenessClassifier::isClosed(const CFBoard &board, bool wasClosed) {
+	float currentScore = score(board);
+	if (wasClosed) {
+		return currentScore <= thresholds.openAbove;
+	}
+	return currentScore < thresholds.closedBelow;
+}
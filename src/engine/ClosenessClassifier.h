@@ -0,0 +1,80 @@
+#pragma once
+#include <CFBoard.h>
+#include <GeneralRegression.h>
+#include <stdint.h>
+
+/*---DESCRIPTION---
+
+Decides whether a position is closed, from its pawns, with the regression of
+src/play (EvaluationFunction::Evaluate on the SqrtDifBasis, trained once by
+EvaluationFunction::getTheta).
+
+The regression was trained with 0.01 for closed positions and 0.99 for open
+ones, so its score is low when the position is closed. Between
+Thresholds::closedBelow and Thresholds::openAbove the previous decision is
+kept, so that a score moving around a single threshold does not switch the
+engine at every move.
+
+The score only depends on the pawns: it is cached by the pawn hash of the
+board (checked against the pawn bitboards), and a position whose pawns did
+not move since an earlier call costs a lookup.
+
+*/
+
+class ClosenessClassifier {
+public:
+	struct Thresholds {
+		float closedBelow = 0.4f; // an open position becomes closed under this
+		float openAbove = 0.6f;	 // a closed position becomes open over this
+	};
+
+	struct CacheStats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+	};
+
+	ClosenessClassifier();
+	~ClosenessClassifier();
+	ClosenessClassifier(const ClosenessClassifier &) = delete;
+	ClosenessClassifier &operator=(const ClosenessClassifier &) = delete;
+
+	/**
+	 * @brief Regression score of board, from 0 (closed) to 1 (open).
+	 */
+	float score(const CFBoard &board);
+
+	/**
+	 * @brief Whether board is closed, knowing whether the previous position was.
+	 */
+	bool isClosed(const CFBoard &board, bool wasClosed);
+
+	void setThresholds(const Thresholds &newThresholds) { thresholds = newThresholds; }
+	const Thresholds &getThresholds() const { return thresholds; }
+
+	const CacheStats &getCacheStats() const { return stats; }
+
+	/**
+	 * @brief Pawns in the layout of the regression: for every column, the row
+	 * (0 for the 8th rank) of the most advanced black pawn (top, 8 if none) and
+	 * of the most advanced white pawn (bottom, -1 if none).
+	 */
+	static void pawnRows(uint64_t whitePawns, uint64_t blackPawns, int (&top)[8],
+											 int (&bottom)[8]);
+
+private:
+	struct CacheEntry {
+		uint64_t whitePawns;
+		uint64_t blackPawns;
+		float score;
+		bool valid = false;
+	};
+
+	static const int cacheSize = 4096; // power of two
+	static const int dimension = 23;	 // size of the basis
+
+	Func *basis;
+	Eigen::VectorXd theta;
+	Thresholds thresholds;
+	CacheEntry cache[cacheSize];
+	CacheStats stats;
+};
@@ -1,28 +1,96 @@
 #include "SwitchEngine.h"
 
 SwitchEngine::SwitchEngine(CFBoard &board, Closedfish::Logger *logger)
-		: ChessEngine(), logger(logger) {
+		: ChessEngine(), logger(logger), status(Status::OPEN) {
 	ChessEngine::setBoardPointer(&board);
 	closedfish = new ClosedfishEngine();
 	closedfish->setBoardPointer(&board);
 	stockfish = new StockfishEngine(logger);
 	stockfish->setBoardPointer(&board);
+	classifier = new ClosenessClassifier();
+	// Only ever set by searchWithFallback
+	stockfish->setStopFlag(&stopStockfish);
+}
+
+void SwitchEngine::setSearchLimits(const Closedfish::SearchLimits &limits) {
+	ChessEngine::setSearchLimits(limits);
+	closedfish->setSearchLimits(limits);
+	stockfish->setSearchLimits(limits);
+}
+
+void SwitchEngine::processMove(Closedfish::Move move) {
+	// Both engines share the board: the Stockfish engine moves it
+	stockfish->processMove(move);
+}
+
+void SwitchEngine::setStockfishOptions(
+		const StockfishSession::Options &options) {
+	stockfish->setSessionOptions(options);
+}
+
+void SwitchEngine::setSearchObserver(SearchObserver *observer) {
+	stockfish->setObserver(observer);
 }
 
 Closedfish::Move SwitchEngine::getNextMove() {
-	double ClosenessCoef;
-	ClosenessCoef = ((double)rand() / RAND_MAX) + 1;
-	// Proposal: Maybe change this, depending on breakthrough
-	if (status == Status::CLOSED && ClosenessCoef >= 0.2)
-		status = Status::OPEN;
-	else if (status == Status::OPEN && ClosenessCoef < 0.2)
-		status = Status::CLOSED;
-	(logger ? logger->cout : std::cerr) << "DBG " << ClosenessCoef << std::endl;
+	bool closed = classifier->isClosed(*currentBoard, status == Status::CLOSED);
+	status = closed ? Status::CLOSED : Status::OPEN;
+	CF_LOG_DEBUG("Closeness score ", classifier->score(*currentBoard),
+							 closed ? ", closed" : ", open");
+	// A closed position is never scored above openAbove: only how close it is
+	// to closedBelow matters
+	if (status == Status::CLOSED && concurrentFallback.enabled &&
+			classifier->score(*currentBoard) >=
+					classifier->getThresholds().closedBelow - concurrentFallback.band) {
+		return searchWithFallback();
+	}
 	if (status == Status::CLOSED) {
 		// We choose Closedfish
-		return closedfish->getNextMove();
-	} else {
-		// We choose Stockfish
-		return stockfish->getNextMove();
+		Closedfish::Move move = closedfish->getNextMove();
+		if (std::get<0>(move) != std::get<1>(move)) {
+			return move;
+		}
+		CF_LOG_DEBUG("No DFS1P move, Stockfish plays");
 	}
-}
\ No newline at end of file
+	// We choose Stockfish
+	return stockfish->getNextMove();
+}
+
+void SwitchEngine::setClosenessThresholds(
+		const ClosenessClassifier::Thresholds &thresholds) {
+	classifier->setThresholds(thresholds);
+}
+
+Closedfish::Move SwitchEngine::searchWithFallback() {
+	// DFS1P plays its moves on the board it searches: it gets a copy, and
+	// Stockfish reads the real one meanwhile
+	CFBoard board = *currentBoard;
+	closedfish->setBoardPointer(&board);
+	stopStockfish = false;
+	Closedfish::FallbackResult result;
+	try {
+		result = Closedfish::searchWithFallback(*closedfish, *stockfish, [this] {
+			stopStockfish = true;
+			stockfish->stopSearch();
+		});
+	} catch (...) {
+		stopStockfish = false;
+		closedfish->setBoardPointer(currentBoard);
+		throw;
+	}
+	stopStockfish = false;
+	closedfish->setBoardPointer(currentBoard);
+
+	fallbackStats.searches++;
+	if (!result.usedFallback) {
+		CF_LOG_DEBUG("Concurrent fallback: DFS1P move, ", fallbackStats.fallbacks,
+								 "/", fallbackStats.searches, " fallbacks");
+		return result.move;
+	}
+	fallbackStats.fallbacks++;
+	fallbackStats.savedTime += result.savedTime;
+	CF_LOG_DEBUG("Concurrent fallback: no DFS1P move, Stockfish plays, ",
+							 fallbackStats.fallbacks, "/", fallbackStats.searches,
+							 " fallbacks");
+	return result.move;
+}
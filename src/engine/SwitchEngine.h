@@ -1,14 +1,44 @@
 #pragma once
 #include <CFBoard.h>
 #include <ClosedfishConnect.h>
+#include <ClosenessClassifier.h>
 #include <EngineWrapper.h>
+#include <FallbackSearch.h>
 #include <StockfishConnect.h>
+#include <atomic>
 #include <tuple>
 #include <utils.h>
 
 class SwitchEngine : public Closedfish::ChessEngine {
 public:
 	enum Status { CLOSED, OPEN };
+
+	/**
+	 * @brief Concurrent Stockfish fallback: a closed position whose closeness
+	 * score is at least closedBelow - band, so near the switch to open, is
+	 * searched by DFS1P on a thread of its own while Stockfish searches it on
+	 * the calling thread, see Closedfish::searchWithFallback. DFS1P searches to
+	 * its SearchLimits and its move is played if it finds one, Stockfish being
+	 * stopped then; otherwise Stockfish's move is played, without starting a
+	 * second search. The moves are the ones of the sequential engine.
+	 */
+	struct ConcurrentFallback {
+		bool enabled = false;
+		float band = 0.1f;
+	};
+
+	/**
+	 * @brief Searches with the concurrent fallback so far, and how many of
+	 * them played Stockfish's move because DFS1P had none. savedTime (seconds)
+	 * adds up the time both searches of those ran at once, which the
+	 * sequential engine would have spent one after the other.
+	 */
+	struct FallbackStats {
+		uint64_t searches = 0;
+		uint64_t fallbacks = 0;
+		double savedTime = 0;
+	};
+
 	/**
 	 * @brief Construct a new Switch Engine object
 	 *
@@ -17,12 +47,53 @@ public:
 	 */
 	SwitchEngine() : ChessEngine(), status(Status::OPEN) {}
 	SwitchEngine(CFBoard &board, Closedfish::Logger *logger);
+	/**
+	 * @brief Move of Closedfish (DFS1P) if the position is closed and it finds
+	 * one, of Stockfish otherwise.
+	 */
 	Closedfish::Move getNextMove();
+	/**
+	 * @brief Sets the budget of both engines
+	 */
+	void setSearchLimits(const Closedfish::SearchLimits &limits);
+	/**
+	 * @brief Makes the move on the board, and in the Stockfish session so it
+	 * keeps the whole game even while Closedfish plays.
+	 */
+	void processMove(Closedfish::Move move);
+	/**
+	 * @brief Hash size (MB), threads and pondering of Stockfish
+	 */
+	void setStockfishOptions(const StockfishSession::Options &options);
+	/**
+	 * @brief Observer of the Stockfish searches, nullptr for none
+	 */
+	void setSearchObserver(SearchObserver *observer);
+	/**
+	 * @brief Closeness scores at which the engine switches, see
+	 * ClosenessClassifier
+	 */
+	void setClosenessThresholds(const ClosenessClassifier::Thresholds &thresholds);
+	Status getStatus() const { return status; }
+	void setConcurrentFallback(const ConcurrentFallback &newFallback) {
+		concurrentFallback = newFallback;
+	}
+	const FallbackStats &getFallbackStats() const { return fallbackStats; }
 	Closedfish::Logger
 			*logger; // should be accessed publicly as a substitute for std::cout.
 
 private:
+	/**
+	 * @brief Move of DFS1P with Stockfish searching at once, see
+	 * ConcurrentFallback.
+	 */
+	Closedfish::Move searchWithFallback();
+
 	ClosedfishEngine *closedfish;
 	StockfishEngine *stockfish;
+	ClosenessClassifier *classifier;
 	Status status;
+	ConcurrentFallback concurrentFallback;
+	FallbackStats fallbackStats;
+	std::atomic<bool> stopStockfish{false};
 };
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "test_attack_tables.h"
+
+/**
+ * @brief Compares both slider implementations on every tile of a board, for
+ * both colors. Returns the number of mismatches.
+ */
+static int countSliderMismatches(CFBoard &board) {
+	int mismatches = 0;
+	AttackTables::SliderMode previous = AttackTables::getSliderMode();
+	AttackTables::setSliderMode(AttackTables::SliderMode::LOOKUP);
+	for (int tile = 0; tile < 64; tile++) {
+		for (int color = 0; color < 2; color++) {
+			mismatches += board.getCardinals(tile, color) !=
+										board.getCardinalsClassic(tile, color);
+			mismatches += board.getDiagonals(tile, color) !=
+										board.getDiagonalsClassic(tile, color);
+		}
+	}
+	AttackTables::setSliderMode(previous);
+	return mismatches;
+}
+
+TEST_CASE("Slider tables match the ray walk", "[board][attacks]") {
+	uint64_t seed = 0x9E3779B97F4A7C15ull;
+	for (int i = 0; i < 2000; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		uint64_t occupancy = seed & (seed >> 3);
+		for (int tile = 0; tile < 64; tile++) {
+			REQUIRE(AttackTables::rookAttacks(tile, occupancy) ==
+							AttackTables::slidingAttacksSlow(false, tile, occupancy));
+			REQUIRE(AttackTables::bishopAttacks(tile, occupancy) ==
+							AttackTables::slidingAttacksSlow(true, tile, occupancy));
+		}
+	}
+}
+
+TEST_CASE("Slider tables are bit-exact with the classic code",
+					"[board][attacks]") {
+	CFBoard startBoard;
+	REQUIRE(countSliderMismatches(startBoard) == 0);
+
+	uint64_t seed = 0x2545F4914F6CDD1Dull;
+	for (int i = 0; i < 500; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		uint64_t white = seed & (seed >> 5);
+		uint64_t black = (seed >> 1) & (seed >> 9) & ~white;
+		CFBoard board(0, 0, 0, white | black, 0, 0, -1, 0, black, white, 0);
+		REQUIRE(countSliderMismatches(board) == 0);
+	}
+
+	for (const std::string &fileName : PositionsCorpus::fileNames) {
+		std::vector<std::string> fens =
+				PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + fileName);
+		REQUIRE(fens.size() == 500);
+		for (const std::string &fen : fens) {
+			CFBoard board(fen);
+			REQUIRE(countSliderMismatches(board) == 0);
+		}
+	}
+}
@@ -0,0 +1,123 @@
+#include "test_move_generation.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Every legal move as start * 64 + end, read tile by tile with
+ * getLegalMoves. Promotions count once, like in getLegalMoves.
+ */
+static std::vector<int> movesFromGetLegalMoves(CFBoard &board) {
+	std::vector<int> moves;
+	for (int startTile = 0; startTile < 64; startTile++) {
+		int pieceId = board.getPieceFromCoords(startTile);
+		if (pieceId == -1 || (pieceId & 1) != board.getCurrentPlayer())
+			continue;
+		uint64_t endTiles = board.getLegalMoves(pieceId, startTile);
+		while (endTiles) {
+			moves.push_back(startTile * 64 + __builtin_ctzll(endTiles));
+			endTiles &= endTiles - 1;
+		}
+	}
+	std::sort(moves.begin(), moves.end());
+	return moves;
+}
+
+/**
+ * @brief Same as movesFromGetLegalMoves, from generateMoves.
+ */
+static std::vector<int> movesFromGenerateMoves(CFBoard &board) {
+	MoveList moveList;
+	board.generateMoves(moveList);
+	std::vector<int> moves;
+	for (uint16_t move : moveList) {
+		if (CFMove::type(move) == CFMove::PROMOTION &&
+				CFMove::promotionType(move) != 4)
+			continue;
+		moves.push_back(CFMove::startTile(move) * 64 + CFMove::endTile(move));
+	}
+	std::sort(moves.begin(), moves.end());
+	return moves;
+}
+
+/**
+ * @brief Compares both move sources on every position reached within depth
+ * plies, playing the generated moves with makeMove.
+ */
+static void checkAgainstGetLegalMoves(CFBoard &board, int depth) {
+	REQUIRE(movesFromGenerateMoves(board) == movesFromGetLegalMoves(board));
+	if (depth == 0) {
+		return;
+	}
+	MoveList moveList;
+	board.generateMoves(moveList);
+	for (uint16_t move : moveList) {
+		board.makeMove(move);
+		REQUIRE(board.getHash() == board.computeHash());
+		checkAgainstGetLegalMoves(board, depth - 1);
+		board.undoLastMove();
+	}
+}
+
+static int countMoves(std::string FEN) {
+	CFBoard board(FEN);
+	MoveList moveList;
+	board.generateMoves(moveList);
+	return moveList.size();
+}
+
+TEST_CASE("generateMoves matches the known move counts", "[board][movegen]") {
+	REQUIRE(countMoves("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") == 20);
+	REQUIRE(countMoves("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1") == 48);
+	REQUIRE(countMoves("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1") == 14);
+	REQUIRE(countMoves("r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1") == 6);
+	REQUIRE(countMoves("rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8") == 44);
+
+	// castling through an attacked tile, en passant exposing the king on its row
+	REQUIRE(countMoves("3rk3/8/8/8/8/8/8/R3K3 w Q - 0 1") == 13);
+	REQUIRE(countMoves("1r2k3/8/8/8/8/8/8/R3K3 w Q - 0 1") == 16);
+	REQUIRE(countMoves("8/8/8/K1pP4/8/8/8/7k w - c6 0 1") == 6);
+	REQUIRE(countMoves("8/8/8/K1pP3r/8/8/8/7k w - c6 0 1") == 5);
+}
+
+TEST_CASE("generateMoves agrees with getLegalMoves", "[board][movegen]") {
+	const std::vector<std::string> FENs = {
+			"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+			"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+			"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+			"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+			"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+			"rkq1bnnr/2b2p1p/4pPpP/3pP1P1/p1pP2N1/PpP5/1P4K1/RNBQ1B1R w - - 0 1",
+			"8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1"};
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		checkAgainstGetLegalMoves(board, 2);
+	}
+
+	for (const std::string &fileName : PositionsCorpus::fileNames) {
+		std::vector<std::string> corpus =
+				PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + fileName);
+		for (std::size_t i = 0; i < corpus.size(); i += 25) {
+			CFBoard board(corpus[i]);
+			checkAgainstGetLegalMoves(board, 1);
+		}
+	}
+}
+
+TEST_CASE("makeMove plays castling, en passant and promotions", "[board][movegen]") {
+	CFBoard board("r3k2r/8/8/8/3p4/8/4P2p/R3K2R w KQkq - 0 1");
+	board.makeMove(CFMove::make(60, 62, CFMove::CASTLING));
+	REQUIRE(board.toFEN() == "r3k2r/8/8/8/3p4/8/4P2p/R4RK1 b kq - 0 1");
+
+	board.makeMove(CFMove::make(4, 2, CFMove::CASTLING));
+	REQUIRE(board.toFEN() == "2kr3r/8/8/8/3p4/8/4P2p/R4RK1 w - - 0 1");
+
+	board.makeMove(CFMove::make(52, 36));
+	REQUIRE(board.getCurrentPlayer() == 1);
+	board.makeMove(CFMove::make(35, 44, CFMove::EN_PASSANT));
+	REQUIRE(board.toFEN() == "2kr3r/8/8/8/8/4p3/7p/R4RK1 w - - 0 1");
+
+	board.forceFlipTurn();
+	board.makeMove(CFMove::make(55, 61, CFMove::PROMOTION, 1));
+	REQUIRE(board.getPieceFromCoords(61) == 3);
+	REQUIRE(board.getHash() == board.computeHash());
+}
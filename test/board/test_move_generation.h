@@ -0,0 +1,4 @@
+#pragma once
+#include "../../lib/board_implementation/CFBoard.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include <catch2/catch_test_macros.hpp>
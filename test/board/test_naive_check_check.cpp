@@ -14,3 +14,59 @@ TEST_CASE("Naive check check is correct", "[board]") {
 					"rkq1bnnr/2b2p1p/4pPpP/3pP1P1/p1pP1K2/PpP1N3/1P6/RNBQ1BR1 w - - 0 1")
 					.naiveCheckCheck(0, -1, -1) == false);
 }
+
+/**
+ * @brief Compares the attack-map and the ray-walking check detection on every
+ * (start, end) pair of every piece, then getLegalMoves on every piece, for
+ * both colors.
+ */
+static void compareCheckModes(CFBoard &board) {
+	for (int tile = 0; tile < 64; tile++) {
+		int pieceId = board.getPieceFromCoords(tile);
+		if (pieceId == -1)
+			continue;
+		bool color = pieceId & 1;
+		for (int endTile = 0; endTile < 64; endTile++) {
+			if (endTile == tile)
+				continue;
+			AttackTables::setCheckMode(AttackTables::CheckMode::CLASSIC);
+			bool classic = board.naiveCheckCheck(color, tile, endTile);
+			AttackTables::setCheckMode(AttackTables::CheckMode::ATTACK_MAP);
+			REQUIRE(board.naiveCheckCheck(color, tile, endTile) == classic);
+		}
+		AttackTables::setCheckMode(AttackTables::CheckMode::CLASSIC);
+		uint64_t classic = board.getLegalMoves(pieceId, tile);
+		AttackTables::setCheckMode(AttackTables::CheckMode::ATTACK_MAP);
+		REQUIRE(board.getLegalMoves(pieceId, tile) == classic);
+	}
+}
+
+TEST_CASE("Attack-map check detection matches the classic one", "[board]") {
+	const std::vector<std::string> FENs = {
+			"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+			"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+			"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+			"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+			"8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1",
+			"8/8/8/K1pP3r/8/8/8/7k w - c6 0 1"};
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareCheckModes(board);
+		MoveList moveList;
+		board.generateMoves(moveList);
+		for (uint16_t move : moveList) {
+			board.makeMove(move);
+			compareCheckModes(board);
+			board.undoLastMove();
+		}
+	}
+
+	for (const std::string &fileName : PositionsCorpus::fileNames) {
+		std::vector<std::string> corpus =
+				PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + fileName);
+		for (std::size_t i = 0; i < corpus.size(); i += 10) {
+			CFBoard board(corpus[i]);
+			compareCheckModes(board);
+		}
+	}
+}
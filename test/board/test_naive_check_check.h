@@ -1,5 +1,7 @@
 #pragma once
+#include "../../lib/board_implementation/AttackTables.h"
 #include "../../lib/board_implementation/CFBoard.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
 #include <catch2/catch_test_macros.hpp>
 #include <string>
 #include <tuple>
@@ -0,0 +1,96 @@
+#include "test_position_view.h"
+
+/**
+ * @brief Compares every query of a view with the board it was taken from, for
+ * every piece: legal moves (castling and en passant aside), attackers, pins.
+ */
+static void compareWithBoard(CFBoard &board) {
+	PositionView position(board);
+	uint64_t occupancy = board.getColorBitBoard(0) | board.getColorBitBoard(1);
+	REQUIRE(position.occupancy() == occupancy);
+	for (bool color : {false, true}) {
+		int kingTile = position.kingTile(color);
+		REQUIRE(kingTile != -1);
+		REQUIRE(position.pinnedPieces(color, occupancy) == board.pinnedPieces(color, kingTile));
+		REQUIRE(position.attackedTiles(color, occupancy) == board.attackedTiles(color, occupancy));
+	}
+	for (int tile = 0; tile < 64; tile++) {
+		int pieceId = board.getPieceFromCoords(tile);
+		REQUIRE(position.pieceAt(tile) == pieceId);
+		REQUIRE(position.attackersTo(tile, occupancy) == board.attackersTo(tile, occupancy));
+		if (pieceId == -1) {
+			continue;
+		}
+		uint64_t expected = board.getLegalMoves(pieceId, tile);
+		if ((pieceId >> 1) == 5) {
+			expected &= AttackTables::kingAttacks[tile]; // castling
+		}
+		if ((pieceId >> 1) == 0 && board.getEnPassantTarget() != -1 && (tile & 7) != (board.getEnPassantTarget() & 7)) {
+			expected &= ~(1ull << board.getEnPassantTarget());
+		}
+		INFO(board.toFEN() << ", piece on " << tile);
+		REQUIRE(position.legalMoves(tile) == expected);
+		for (int endTile = 0; endTile < 64; endTile++) {
+			if ((expected >> endTile) & 1) {
+				REQUIRE(position.isMoveLegal(tile, endTile));
+			}
+		}
+	}
+}
+
+static void compareWithBoard(CFBoard &board, int depth) {
+	compareWithBoard(board);
+	if (depth == 0) {
+		return;
+	}
+	MoveList moveList;
+	board.generateMoves(moveList);
+	for (uint16_t move : moveList) {
+		board.makeMove(move);
+		compareWithBoard(board, depth - 1);
+		board.undoLastMove();
+	}
+}
+
+TEST_CASE("PositionView answers like the board it was taken from", "[board][view]") {
+	// Pins, checks, castling, en passant and promotions
+	std::vector<std::string> FENs = {
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+	};
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareWithBoard(board, 1);
+	}
+
+	std::vector<std::string> corpus = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/general_positions.txt");
+	REQUIRE(!corpus.empty());
+	for (int i = 0; i < (int)corpus.size(); i += 10) {
+		CFBoard board(corpus[i]);
+		compareWithBoard(board, 1);
+	}
+}
+
+TEST_CASE("PositionView is a snapshot", "[board][view]") {
+	CFBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+	PositionView position(board);
+	std::string FEN = board.toFEN();
+	MoveList moveList;
+	board.generateMoves(moveList);
+	board.makeMove(moveList[0]);
+	REQUIRE(position.occupancy() != (board.getColorBitBoard(0) | board.getColorBitBoard(1)));
+	board.undoLastMove();
+	REQUIRE(board.toFEN() == FEN);
+
+	// without only changes the copy
+	int tile = position.kingTile(0);
+	PositionView withoutKing = position.without(tile);
+	REQUIRE(withoutKing.kingTile(0) == -1);
+	REQUIRE(withoutKing.pieceAt(tile) == -1);
+	REQUIRE(position.kingTile(0) == tile);
+	REQUIRE(withoutKing.occupancy() == (position.occupancy() & ~(1ull << tile)));
+}
@@ -0,0 +1,6 @@
+#pragma once
+#include "../../lib/board_implementation/CFBoard.h"
+#include "../../lib/board_implementation/AttackTables.h"
+#include "../../lib/board_implementation/PositionView.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include <catch2/catch_test_macros.hpp>
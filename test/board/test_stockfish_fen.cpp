@@ -0,0 +1,44 @@
+#include "test_stockfish_fen.h"
+
+// Compares the two FENs on board and on every position one ply away from it,
+// so both players, en passant targets and lost castling rights are covered.
+static void compareWithChildren(CFBoard &board) {
+	INFO(board.toFEN());
+	REQUIRE(stockfishFEN(board) == board.toFEN());
+	MoveList moveList;
+	board.generateMoves(moveList);
+	for (int i = 0; i < moveList.size(); i++) {
+		board.makeMove(moveList[i]);
+		INFO(board.toFEN());
+		REQUIRE(stockfishFEN(board) == board.toFEN());
+		board.undoLastMove();
+	}
+}
+
+TEST_CASE("stockfishFEN matches toFEN", "[board][fen]") {
+	// Castling, en passant, promotions and black to move
+	std::vector<std::string> FENs = {
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"rnbqkbnr/pppp1ppp/8/8/3Pp3/8/PPP1PPPP/RNBQKBNR b KQkq d3 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 b kq - 0 1",
+	};
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareWithChildren(board);
+	}
+}
+
+TEST_CASE("stockfishFEN matches toFEN on the corpora", "[board][fen]") {
+	for (const std::string &fileName : PositionsCorpus::fileNames) {
+		std::vector<std::string> corpus =
+			PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + fileName);
+		REQUIRE(!corpus.empty());
+		for (const std::string &FEN : corpus) {
+			CFBoard board(FEN);
+			compareWithChildren(board);
+		}
+	}
+}
@@ -0,0 +1,6 @@
+#pragma once
+#include "../../lib/board_implementation/CFBoard.h"
+#include "../../lib/board_implementation/MoveList.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include "../../lib/board_implementation/StockfishFEN.h"
+#include <catch2/catch_test_macros.hpp>
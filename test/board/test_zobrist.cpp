@@ -0,0 +1,61 @@
+#include "test_zobrist.h"
+
+/**
+ * @brief Plays every legal move up to depth, checking the incremental keys
+ * after each move and that undoLastMove restores them.
+ */
+static void checkHashesRecursively(CFBoard &board, int depth) {
+	REQUIRE(board.getHash() == board.computeHash());
+	REQUIRE(board.getPawnHash() == board.computePawnHash());
+	if (depth == 0) {
+		return;
+	}
+	uint64_t hash = board.getHash(), pawnHash = board.getPawnHash();
+	for (int startTile = 0; startTile < 64; startTile++) {
+		int pieceId = board.getPieceFromCoords(startTile);
+		if (pieceId == -1 || (pieceId & 1) != board.getCurrentPlayer())
+			continue;
+		uint64_t moves = board.getLegalMoves(pieceId, startTile);
+		while (moves) {
+			int endTile = __builtin_ctzll(moves);
+			moves &= moves - 1;
+			board.movePiece(startTile, endTile);
+			checkHashesRecursively(board, depth - 1);
+			board.undoLastMove();
+			REQUIRE(board.getHash() == hash);
+			REQUIRE(board.getPawnHash() == pawnHash);
+		}
+	}
+}
+
+TEST_CASE("Zobrist keys are updated incrementally", "[board][hash]") {
+	CFBoard board;
+	checkHashesRecursively(board, 3);
+
+	CFBoard closed("rkq1bnnr/2b2p1p/4pPpP/3pP1P1/p1pP2N1/PpP5/1P4K1/RNBQ1B1R w - - 0 1");
+	checkHashesRecursively(closed, 2);
+
+	closed.forceRemovePiece(12);
+	closed.forceAddPiece(3, 20);
+	closed.forceFlipTurn();
+	REQUIRE(closed.getHash() == closed.computeHash());
+	REQUIRE(closed.getPawnHash() == closed.computePawnHash());
+}
+
+TEST_CASE("Transpositions share the same key", "[board][hash]") {
+	CFBoard first, second;
+	// Nf3 Nf6 Nc3 against Nc3 Nf6 Nf3
+	first.movePiece(62, 45);
+	first.movePiece(6, 21);
+	first.movePiece(57, 42);
+	second.movePiece(57, 42);
+	second.movePiece(6, 21);
+	second.movePiece(62, 45);
+	REQUIRE(first.getHash() == second.getHash());
+	REQUIRE(first.getPawnHash() == CFBoard().getPawnHash());
+
+	first.forceFlipTurn();
+	REQUIRE(first.getHash() != second.getHash());
+	first.movePiece(52, 36);
+	REQUIRE(first.getPawnHash() != second.getPawnHash());
+}
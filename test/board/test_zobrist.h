@@ -0,0 +1,3 @@
+#pragma once
+#include "../../lib/board_implementation/CFBoard.h"
+#include <catch2/catch_test_macros.hpp>
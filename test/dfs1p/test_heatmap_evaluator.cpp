@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_heatmap_evaluator.h"
+#include <cstring>
+#include <random>
+
+TEST_CASE("Incremental heatmap distance matches distFromHeatmap", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	std::vector<std::string> generalFENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/general_positions.txt");
+	REQUIRE(!FENs.empty());
+	REQUIRE(!generalFENs.empty());
+	FENs.resize(std::min<int>(50, FENs.size()));
+	FENs.insert(FENs.end(), generalFENs.begin(), generalFENs.begin() + std::min<int>(50, generalFENs.size()));
+	FENs.push_back("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+	DFS1P engine;
+	std::mt19937 rng(201);
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		int heatMap[6][8][8];
+		for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+			for (int i = 0; i < 8; i++) {
+				for (int j = 0; j < 8; j++) {
+					heatMap[halfPieceId][i][j] = rng() % 4 == 0 ? rng() % 5 : 0;
+				}
+			}
+		}
+
+		HeatmapEvaluator evaluator(board, heatMap);
+		REQUIRE(evaluator.getDistance() == engine.distFromHeatmap(board, heatMap));
+
+		// Random lines of the current player only, then back to the start
+		for (int line = 0; line < 5; line++) {
+			int played = 0;
+			for (int ply = 0; ply < 6; ply++) {
+				MoveList moveList;
+				board.generateMoves(moveList);
+				if (moveList.empty()) break;
+				evaluator.play(moveList[rng() % moveList.size()]);
+				played++;
+				INFO(FEN << " -> " << board.toFEN());
+				REQUIRE(evaluator.getDistance() == engine.distFromHeatmap(board, heatMap));
+			}
+			while (played--) {
+				evaluator.undo();
+				REQUIRE(evaluator.getDistance() == engine.distFromHeatmap(board, heatMap));
+			}
+			REQUIRE(board.toFEN() == CFBoard(FEN).toFEN());
+		}
+	}
+}
+
+TEST_CASE("DFS1P picks the same move with the incremental evaluation", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+
+	DFS1P full, incremental;
+	full.setEvaluationMode(DFS1P::EvaluationMode::FULL);
+	full.setHashSize(0);
+	incremental.setHashSize(0);
+	for (int i = 0; i < std::min<int>(40, FENs.size()); i++) {
+		CFBoard board(FENs[i]), reference(FENs[i]);
+		full.setBoardPointer(&reference);
+		incremental.setBoardPointer(&board);
+		Closedfish::Move expected = full.getNextMove();
+		Closedfish::Move move = incremental.getNextMove();
+		INFO(FENs[i]);
+		REQUIRE(std::get<0>(move) == std::get<0>(expected));
+		REQUIRE(std::get<1>(move) == std::get<1>(expected));
+	}
+}
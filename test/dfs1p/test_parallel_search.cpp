@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_parallel_search.h"
+#include <tuple>
+
+TEST_CASE("DFS1P picks the same move with several threads", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+
+	for (std::size_t hashSize : {0, 16}) {
+		DFS1P single, parallel;
+		single.setHashSize(hashSize);
+		parallel.setHashSize(hashSize);
+		parallel.setThreads(4);
+		for (int i = 0; i < std::min<int>(10, FENs.size()); i++) {
+			CFBoard board(FENs[i]), reference(FENs[i]);
+			single.setBoardPointer(&reference);
+			parallel.setBoardPointer(&board);
+
+			Closedfish::Move expected = single.getNextMove();
+			Closedfish::Move move = parallel.getNextMove();
+			INFO(FENs[i] << ", hash size " << hashSize);
+			REQUIRE(std::get<0>(move) == std::get<0>(expected));
+			REQUIRE(std::get<1>(move) == std::get<1>(expected));
+			REQUIRE(parallel.getCompletedDepth() == single.getCompletedDepth());
+			REQUIRE(board.toFEN() == reference.toFEN());
+		}
+	}
+}
+
+TEST_CASE("DFS1P parallel search stops at the node budget", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+
+	DFS1P engine;
+	engine.setHashSize(0);
+	engine.setThreads(4);
+	Closedfish::SearchLimits limits;
+	limits.maxDepth = 10;
+	limits.maxNodes = 500;
+	engine.setSearchLimits(limits);
+	for (int i = 0; i < std::min<int>(10, FENs.size()); i++) {
+		CFBoard board(FENs[i]);
+		std::string FEN = board.toFEN();
+		engine.setBoardPointer(&board);
+		engine.getNextMove();
+		REQUIRE(engine.getCompletedDepth() < 10);
+		REQUIRE(board.toFEN() == FEN);
+	}
+}
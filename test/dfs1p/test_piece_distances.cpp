@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_piece_distances.h"
+#include <cstring>
+
+namespace {
+
+// Compares both distance modes for every piece of the player to move
+void compareDistances(DFS1P &engine, CFBoard &board) {
+	bool color = board.getCurrentPlayer();
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		for (int tile : bitSetPositions(board.getPieceColorBitBoard(2 * halfPieceId | color))) {
+			engine.setDistanceMode(DFS1P::DistanceMode::BFS);
+			std::array<int, 64> expected = engine.distFromTileToTilesAsPiece(board, halfPieceId, tile);
+			engine.setDistanceMode(DFS1P::DistanceMode::FLOOD_FILL);
+			std::array<int, 64> dist = engine.distFromTileToTilesAsPiece(board, halfPieceId, tile);
+			INFO(board.toFEN() << ", piece " << halfPieceId << " on " << tile);
+			REQUIRE(dist == expected);
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("Flood fill distances match the BFS", "[dfs1p]") {
+	DFS1P engine;
+	// Pins, checks, castling, en passant and promotions
+	std::vector<std::string> FENs = {
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+		"8/8/8/K1pP3r/8/8/8/7k w - c6 0 1",
+		"8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1",
+		"4k3/8/8/8/4r3/8/4R3/4K3 w - - 0 1",
+		"4k3/8/8/b7/8/2N5/8/4K3 w - - 0 1",
+		"4k3/8/8/7b/8/8/4Q3/3K4 w - - 0 1",
+		"4k3/8/8/8/8/8/2B5/r3K3 w - - 0 1"};
+	for (const char *corpus : {"completely_closed_positions.txt", "general_positions.txt"}) {
+		std::vector<std::string> corpusFENs = PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + corpus);
+		REQUIRE(!corpusFENs.empty());
+		FENs.insert(FENs.end(), corpusFENs.begin(), corpusFENs.begin() + std::min<int>(100, corpusFENs.size()));
+	}
+
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareDistances(engine, board);
+		// And the positions one quiet move later, the opponent not moving
+		MoveList moveList;
+		board.generateMoves(moveList);
+		for (uint16_t move : moveList) {
+			board.makeMove(move);
+			board.forceFlipTurn();
+			compareDistances(engine, board);
+			board.undoLastMove();
+		}
+	}
+}
+
+TEST_CASE("Flood fill distances are cached", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+	CFBoard board(FENs[0]);
+	int heatMap[6][8][8];
+	memset(heatMap, 0, sizeof(heatMap));
+	for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+		heatMap[halfPieceId][4][4] = 1;
+	}
+
+	DFS1P engine;
+	engine.setDistanceMode(DFS1P::DistanceMode::BFS);
+	int expected = engine.distFromHeatmap(board, heatMap);
+	engine.setDistanceMode(DFS1P::DistanceMode::FLOOD_FILL);
+	PieceDistances::clearCache();
+	REQUIRE(engine.distFromHeatmap(board, heatMap) == expected);
+	PieceDistances::CacheStats first = PieceDistances::getCacheStats();
+	REQUIRE(first.hits == 0);
+	REQUIRE(first.misses > 0);
+
+	// Same position again: every piece is found in the cache
+	REQUIRE(engine.distFromHeatmap(board, heatMap) == expected);
+	PieceDistances::CacheStats second = PieceDistances::getCacheStats();
+	REQUIRE(second.hits == first.misses);
+	REQUIRE(second.misses == first.misses);
+}
+
+TEST_CASE("Cached pawn distances depend on the en passant target", "[dfs1p]") {
+	// The e4 pawn takes en passant on d6 from e5 only while d6 is the target:
+	// the same pieces without the target must not reuse that distance
+	DFS1P engine;
+	PieceDistances::clearCache();
+	for (const char *FEN : {"4k3/8/8/3p4/4P3/8/8/4K3 w - d6 0 1",
+													"4k3/8/8/3p4/4P3/8/8/4K3 w - - 0 1",
+													"4k3/8/8/3p4/4P3/8/8/4K3 w - d6 0 1"}) {
+		CFBoard board(FEN);
+		compareDistances(engine, board);
+	}
+}
@@ -0,0 +1,4 @@
+#pragma once
+#include "../../lib/DFS1P/DFS1P.h"
+#include "../../lib/DFS1P/PieceDistances.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
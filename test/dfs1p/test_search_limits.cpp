@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_search_limits.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tuple>
+
+namespace {
+
+// First closed position where getNextMove searches (no pawn capture to take)
+CFBoard closedPosition() {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		DFS1P engine;
+		engine.setBoardPointer(&board);
+		engine.getNextMove();
+		if (engine.getCompletedDepth() > 0) {
+			return CFBoard(FEN);
+		}
+	}
+	FAIL("no searched position in the corpus");
+	return CFBoard();
+}
+
+} // namespace
+
+TEST_CASE("DFS1P deepens up to the depth limit", "[dfs1p]") {
+	CFBoard board = closedPosition();
+	DFS1P engine;
+	engine.setBoardPointer(&board);
+
+	// Default limits: depth 3, no time or node limit
+	Closedfish::Move move = engine.getNextMove();
+	REQUIRE(engine.getCompletedDepth() == 3);
+	REQUIRE(std::get<0>(move) != std::get<1>(move));
+
+	Closedfish::SearchLimits limits;
+	limits.maxDepth = 1;
+	engine.setSearchLimits(limits);
+	engine.getNextMove();
+	REQUIRE(engine.getCompletedDepth() == 1);
+}
+
+TEST_CASE("DFS1P returns the move of the last finished depth when the budget is spent", "[dfs1p]") {
+	CFBoard board = closedPosition();
+	std::string FEN = board.toFEN();
+
+	// Reference: best move of each depth, without limits
+	std::vector<Closedfish::Move> bestMoves = {{}};
+	for (int depth = 1; depth <= 3; depth++) {
+		DFS1P reference;
+		Closedfish::SearchLimits limits;
+		limits.maxDepth = depth;
+		reference.setSearchLimits(limits);
+		reference.setBoardPointer(&board);
+		bestMoves.push_back(reference.getNextMove());
+		REQUIRE(reference.getCompletedDepth() == depth);
+	}
+
+	SECTION("node budget") {
+		DFS1P engine;
+		engine.setHashSize(0);
+		Closedfish::SearchLimits limits;
+		limits.maxDepth = 3;
+		limits.maxNodes = 200;
+		engine.setSearchLimits(limits);
+		engine.setBoardPointer(&board);
+		Closedfish::Move move = engine.getNextMove();
+
+		int depth = engine.getCompletedDepth();
+		REQUIRE(depth >= 1);
+		REQUIRE(depth < 3);
+		REQUIRE(std::get<0>(move) == std::get<0>(bestMoves[depth]));
+		REQUIRE(std::get<1>(move) == std::get<1>(bestMoves[depth]));
+	}
+
+	SECTION("time budget") {
+		DFS1P engine;
+		engine.setHashSize(0);
+		Closedfish::SearchLimits limits;
+		limits.maxDepth = 20;
+		limits.maxTime = 0.05;
+		engine.setSearchLimits(limits);
+		engine.setBoardPointer(&board);
+
+		auto start = std::chrono::steady_clock::now();
+		Closedfish::Move move = engine.getNextMove();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		int depth = engine.getCompletedDepth();
+		REQUIRE(depth >= 1);
+		REQUIRE(depth < 20);
+		REQUIRE(elapsed.count() < 1.0);
+		if (depth <= 3) {
+			REQUIRE(std::get<0>(move) == std::get<0>(bestMoves[depth]));
+			REQUIRE(std::get<1>(move) == std::get<1>(bestMoves[depth]));
+		}
+	}
+
+	REQUIRE(board.toFEN() == FEN);
+}
+
+TEST_CASE("DFS1P stops when its stop flag is set", "[dfs1p]") {
+	CFBoard board = closedPosition();
+	std::string FEN = board.toFEN();
+	std::atomic<bool> stop{false};
+	DFS1P engine;
+	engine.setHashSize(0);
+	engine.setStopFlag(&stop);
+	engine.setBoardPointer(&board);
+
+	SECTION("set before the search") {
+		stop = true;
+		Closedfish::Move move = engine.getNextMove();
+		REQUIRE(engine.getCompletedDepth() == 0);
+		REQUIRE(std::get<0>(move) == std::get<1>(move));
+	}
+
+	SECTION("set by another thread during the search") {
+		// Without a time or node limit, only the flag ends this search
+		Closedfish::SearchLimits limits;
+		limits.maxDepth = 20;
+		engine.setSearchLimits(limits);
+		std::thread stopper([&stop] {
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			stop = true;
+		});
+		auto start = std::chrono::steady_clock::now();
+		Closedfish::Move move = engine.getNextMove();
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		stopper.join();
+
+		REQUIRE(engine.getCompletedDepth() >= 1);
+		REQUIRE(engine.getCompletedDepth() < 20);
+		REQUIRE(std::get<0>(move) != std::get<1>(move));
+		REQUIRE(elapsed.count() < 1.0);
+	}
+
+	REQUIRE(board.toFEN() == FEN);
+}
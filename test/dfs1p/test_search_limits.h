@@ -0,0 +1,3 @@
+#pragma once
+#include "../../lib/DFS1P/DFS1P.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_transposition_table.h"
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <tuple>
+
+TEST_CASE("Transposition table stores and replaces entries", "[dfs1p]") {
+	TranspositionTable tt(1);
+	// Power of two number of buckets of 64 bytes, within 1 MB
+	REQUIRE(tt.getBucketCount() == (1 << 14));
+
+	tt.newSearch();
+	TranspositionTable::Entry entry;
+	REQUIRE(!tt.probe(42, 3, entry));
+	tt.store(42, 3, -7, CFMove::make(52, 36));
+	REQUIRE(tt.probe(42, 3, entry));
+	REQUIRE(entry.key == 42);
+	REQUIRE(entry.score == -7);
+	REQUIRE(entry.bestMove == CFMove::make(52, 36));
+	REQUIRE(entry.depth == 3);
+	REQUIRE(entry.generation == tt.getGeneration());
+	// Same key, other remaining depth: another entry
+	REQUIRE(!tt.probe(42, 2, entry));
+
+	// Overwriting keeps a single entry
+	tt.store(42, 3, 5, 0);
+	REQUIRE(tt.probe(42, 3, entry));
+	REQUIRE(entry.score == 5);
+	tt.store(42, 3, TranspositionTable::noScore, 0);
+	REQUIRE(tt.probe(42, 3, entry));
+	REQUIRE(entry.score == TranspositionTable::noScore);
+
+	// Fill the bucket of key 42 in a later search: the entry of the older search
+	// is the one replaced
+	tt.newSearch();
+	uint64_t step = tt.getBucketCount();
+	for (int i = 1; i < TranspositionTable::bucketSize; i++) {
+		tt.store(42 + i * step, 0, i, 0);
+	}
+	REQUIRE(tt.probe(42, 3, entry));
+	tt.store(42 + TranspositionTable::bucketSize * step, 0, 0, 0);
+	REQUIRE(!tt.probe(42, 3, entry));
+	for (int i = 1; i <= TranspositionTable::bucketSize; i++) {
+		REQUIRE(tt.probe(42 + i * step, 0, entry));
+	}
+
+	tt.clear();
+	REQUIRE(!tt.probe(42 + step, 0, entry));
+}
+
+TEST_CASE("Transposition table can be shared between threads", "[dfs1p]") {
+	TranspositionTable tt(1);
+	tt.newSearch();
+	// Threads write different data under the same keys: a probe must only find
+	// data that was written with its key
+	std::atomic<bool> torn(false);
+	std::vector<std::thread> pool;
+	for (int t = 0; t < 4; t++) {
+		pool.emplace_back([&tt, &torn, t]() {
+			for (int i = 0; i < 100000; i++) {
+				uint64_t key = (uint64_t)(i % 64) * 0x9E3779B97F4A7C15ull;
+				tt.store(key, 1, (int32_t)(key >> 40) + t, (uint16_t)t);
+				TranspositionTable::Entry entry;
+				if (tt.probe(key, 1, entry) && entry.score != (int32_t)(key >> 40) + entry.bestMove) {
+					torn = true;
+				}
+			}
+		});
+	}
+	for (std::thread &thread : pool) {
+		thread.join();
+	}
+	REQUIRE(!torn);
+}
+
+TEST_CASE("DFS1P picks the same move with or without the transposition table", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+
+	DFS1P withTable, withoutTable;
+	withoutTable.setHashSize(0);
+	for (int i = 0; i < std::min<int>(10, FENs.size()); i++) {
+		CFBoard board(FENs[i]), reference(FENs[i]);
+		withTable.setBoardPointer(&board);
+		withoutTable.setBoardPointer(&reference);
+
+		Closedfish::Move expected = withoutTable.getNextMove();
+		Closedfish::Move move = withTable.getNextMove();
+		INFO(FENs[i]);
+		REQUIRE(std::get<0>(move) == std::get<0>(expected));
+		REQUIRE(std::get<1>(move) == std::get<1>(expected));
+		// The search leaves the board as it was
+		REQUIRE(board.toFEN() == reference.toFEN());
+
+		// Searching again reuses the stored best line
+		Closedfish::Move repeated = withTable.getNextMove();
+		REQUIRE(std::get<0>(repeated) == std::get<0>(expected));
+		REQUIRE(std::get<1>(repeated) == std::get<1>(expected));
+	}
+}
+
+TEST_CASE("DFS1P search keeps only the best line", "[dfs1p]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+
+	CFBoard board(FENs[0]);
+	std::string FEN = board.toFEN();
+	int heatMap[6][8][8];
+	memset(heatMap, 0, sizeof(heatMap));
+	heatMap[1][4][4] = 3; // knights towards e4
+	heatMap[0][3][3] = 1; // pawns towards d5
+
+	DFS1P engine;
+	engine.setHashSize(0);
+	std::vector<Closedfish::Move> curLine, bestLine;
+	int bestDist = TranspositionTable::noScore;
+	int score = engine.DFS1pAux(&board, 0, 2, heatMap, curLine, bestLine, bestDist);
+
+	REQUIRE(curLine.empty());
+	REQUIRE(board.toFEN() == FEN);
+	REQUIRE(score == bestDist);
+	REQUIRE(bestLine.size() == 2);
+
+	// The returned line has the returned distance
+	for (const Closedfish::Move &move : bestLine) {
+		board.movePiece(std::get<0>(move), std::get<1>(move));
+		board.forceFlipTurn();
+	}
+	REQUIRE(engine.distFromHeatmap(board, heatMap) == bestDist);
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_closeness_classifier.h"
+
+namespace {
+
+const char *startFEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+std::vector<std::string> corpus(const char *name) {
+	std::vector<std::string> FENs =
+			PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + name);
+	REQUIRE(!FENs.empty());
+	return FENs;
+}
+
+} // namespace
+
+TEST_CASE("pawnRows gives the most advanced pawn of each column", "[engine]") {
+	int top[8], bottom[8];
+	CFBoard start(startFEN);
+	uint64_t pawns = start.getPieceBoardFromIndex(0);
+	ClosenessClassifier::pawnRows(pawns & start.getColorBitBoard(0),
+																pawns & start.getColorBitBoard(1), top, bottom);
+	for (int col = 0; col < 8; col++) {
+		REQUIRE(top[col] == 1);
+		REQUIRE(bottom[col] == 6);
+	}
+
+	// Doubled pawns on the d file, no pawn anywhere else
+	CFBoard doubled("4k3/8/3p4/3p4/3P4/3P4/8/4K3 w - - 0 1");
+	pawns = doubled.getPieceBoardFromIndex(0);
+	ClosenessClassifier::pawnRows(pawns & doubled.getColorBitBoard(0),
+																pawns & doubled.getColorBitBoard(1), top, bottom);
+	for (int col = 0; col < 8; col++) {
+		INFO("column " << col);
+		REQUIRE(top[col] == (col == 3 ? 3 : 8));
+		REQUIRE(bottom[col] == (col == 3 ? 4 : -1));
+	}
+}
+
+TEST_CASE("The classifier separates the closed and open corpora", "[engine]") {
+	ClosenessClassifier classifier;
+	for (const std::string &FEN : corpus("completely_closed_positions.txt")) {
+		INFO(FEN << ", score " << classifier.score(CFBoard(FEN)));
+		REQUIRE(classifier.isClosed(CFBoard(FEN), false));
+	}
+	for (const char *name : {"0_to_4_positions.txt", "6_white_6_black_positions.txt"}) {
+		for (const std::string &FEN : corpus(name)) {
+			INFO(FEN << ", score " << classifier.score(CFBoard(FEN)));
+			REQUIRE(!classifier.isClosed(CFBoard(FEN), false));
+		}
+	}
+}
+
+TEST_CASE("Between the thresholds the previous decision is kept", "[engine]") {
+	ClosenessClassifier classifier;
+	CFBoard board(startFEN);
+	float score = classifier.score(board);
+
+	classifier.setThresholds({score - 0.05f, score + 0.05f});
+	REQUIRE(classifier.isClosed(board, true));
+	REQUIRE(!classifier.isClosed(board, false));
+
+	// Out of the band, the score decides alone
+	classifier.setThresholds({score + 0.05f, score + 0.1f});
+	REQUIRE(classifier.isClosed(board, true));
+	REQUIRE(classifier.isClosed(board, false));
+	classifier.setThresholds({score - 0.1f, score - 0.05f});
+	REQUIRE(!classifier.isClosed(board, true));
+	REQUIRE(!classifier.isClosed(board, false));
+}
+
+TEST_CASE("Scores are cached by the pawns", "[engine]") {
+	ClosenessClassifier classifier;
+	CFBoard board(startFEN);
+	float score = classifier.score(board);
+	REQUIRE(classifier.getCacheStats().misses == 1);
+	REQUIRE(classifier.score(board) == score);
+	REQUIRE(classifier.getCacheStats().hits == 1);
+
+	// A piece move keeps the pawns, and so the entry
+	CFBoard knightOut("rnbqkbnr/pppppppp/8/8/8/5N2/PPPPPPPP/RNBQKB1R b KQkq - 1 1");
+	REQUIRE(classifier.score(knightOut) == score);
+	REQUIRE(classifier.getCacheStats().hits == 2);
+
+	// A pawn move does not
+	CFBoard pawnOut("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+	classifier.score(pawnOut);
+	REQUIRE(classifier.getCacheStats().misses == 2);
+	REQUIRE(classifier.getCacheStats().hits == 2);
+}
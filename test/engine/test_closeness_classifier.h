@@ -0,0 +1,3 @@
+#pragma once
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include "../../src/engine/ClosenessClassifier.h"
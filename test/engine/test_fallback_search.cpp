@@ -0,0 +1,153 @@
+#include "test_fallback_search.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+const Closedfish::Move noMove{0, 0, 0};
+
+// Answers move after seconds, earlier if its stop flag is set
+class FakeEngine : public Closedfish::ChessEngine {
+public:
+	FakeEngine(Closedfish::Move move, double seconds)
+			: move(move), seconds(seconds) {}
+
+	Closedfish::Move getNextMove() {
+		auto start = std::chrono::steady_clock::now();
+		while (std::chrono::duration<double>(std::chrono::steady_clock::now() -
+																				 start)
+							 .count() < seconds) {
+			if (stop) {
+				stopped = true;
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		searches++;
+		if (fail) {
+			throw "search failed";
+		}
+		return move;
+	}
+
+	Closedfish::Move move;
+	double seconds;
+	bool fail = false;
+	std::atomic<bool> stop{false};
+	std::atomic<bool> stopped{false};
+	int searches = 0;
+};
+
+double secondsOf(const std::function<void()> &run) {
+	auto start = std::chrono::steady_clock::now();
+	run();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+			.count();
+}
+
+} // namespace
+
+TEST_CASE("The preferred move stops the fallback", "[engine][fallback]") {
+	FakeEngine preferred({12, 20, 1}, 0.02);
+	FakeEngine fallback({52, 36, 2}, 5);
+	Closedfish::FallbackResult result;
+	double elapsed = secondsOf([&] {
+		result = Closedfish::searchWithFallback(
+				preferred, fallback, [&fallback] { fallback.stop = true; });
+	});
+	REQUIRE(result.move == preferred.move);
+	REQUIRE(!result.usedFallback);
+	REQUIRE(result.savedTime == 0);
+	REQUIRE(fallback.stopped);
+	REQUIRE(elapsed < 2);
+}
+
+TEST_CASE("The fallback answer does not cut the preferred search",
+					"[engine][fallback]") {
+	// The fallback answers first, the preferred engine still finds its move
+	FakeEngine preferred({12, 20, 1}, 0.2);
+	FakeEngine fallback({52, 36, 2}, 0.01);
+	Closedfish::FallbackResult result;
+	double elapsed = secondsOf([&] {
+		result = Closedfish::searchWithFallback(
+				preferred, fallback, [&fallback] { fallback.stop = true; });
+	});
+	REQUIRE(result.move == preferred.move);
+	REQUIRE(!result.usedFallback);
+	REQUIRE(!preferred.stopped);
+	REQUIRE(elapsed >= 0.2);
+
+	// Same without a preferred move: the fallback move is played once the
+	// preferred search ended, and the overlap is the fallback search
+	preferred.move = noMove;
+	fallback.stop = false;
+	result = Closedfish::searchWithFallback(
+			preferred, fallback, [&fallback] { fallback.stop = true; });
+	REQUIRE(result.move == fallback.move);
+	REQUIRE(result.usedFallback);
+	REQUIRE(!preferred.stopped);
+	REQUIRE(result.savedTime >= 0.01);
+	REQUIRE(result.savedTime < 0.2);
+}
+
+TEST_CASE("Without a preferred move the fallback runs to its end",
+					"[engine][fallback]") {
+	FakeEngine preferred(noMove, 0.01);
+	FakeEngine fallback({52, 36, 2}, 0.2);
+	Closedfish::FallbackResult result = Closedfish::searchWithFallback(
+			preferred, fallback, [&fallback] { fallback.stop = true; });
+	REQUIRE(result.move == fallback.move);
+	REQUIRE(result.usedFallback);
+	REQUIRE(!fallback.stopped);
+	// The sequential engine would have waited for the preferred search first
+	REQUIRE(result.savedTime >= 0.01);
+	REQUIRE(result.savedTime < 0.2);
+}
+
+TEST_CASE("A search with a fallback rethrows the errors of the engines it needs",
+					"[engine][fallback]") {
+	FakeEngine preferred({12, 20, 1}, 0.01);
+	FakeEngine fallback({52, 36, 2}, 0.01);
+	fallback.fail = true;
+	auto stopFallback = [&fallback] { fallback.stop = true; };
+	// The fallback move is not needed
+	REQUIRE(Closedfish::searchWithFallback(preferred, fallback, stopFallback)
+							.move == preferred.move);
+	preferred.move = noMove;
+	REQUIRE_THROWS(
+			Closedfish::searchWithFallback(preferred, fallback, stopFallback));
+
+	// A failed preferred search stops the fallback and fails like it would alone
+	fallback.fail = false;
+	fallback.stop = false;
+	fallback.seconds = 5;
+	preferred.fail = true;
+	REQUIRE_THROWS(
+			Closedfish::searchWithFallback(preferred, fallback, stopFallback));
+	REQUIRE(fallback.stopped);
+}
+
+TEST_CASE("DFS1P with a concurrent fallback plays the sequential moves",
+					"[engine][fallback]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+			std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+	for (int i = 0; i < 10 && i < (int)FENs.size(); i++) {
+		INFO(FENs[i]);
+		CFBoard board(FENs[i]);
+		ClosedfishEngine sequential;
+		sequential.setBoardPointer(&board);
+		Closedfish::Move expected = sequential.getNextMove();
+
+		CFBoard copy(FENs[i]);
+		ClosedfishEngine closedfish;
+		closedfish.setBoardPointer(&copy);
+		// A fallback answering at once, as Stockfish does on a tight budget
+		FakeEngine fallback({52, 36, 2}, 0);
+		Closedfish::FallbackResult result = Closedfish::searchWithFallback(
+				closedfish, fallback, [&fallback] { fallback.stop = true; });
+		REQUIRE(result.move == expected);
+		REQUIRE(result.usedFallback == (std::get<0>(expected) == std::get<1>(expected)));
+	}
+}
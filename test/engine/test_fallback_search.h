@@ -0,0 +1,5 @@
+#pragma once
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include "../../lib/engine_wrapper/FallbackSearch.h"
+#include "../../src/connectors/ClosedfishConnect/ClosedfishConnect.h"
+#include <catch2/catch_test_macros.hpp>
@@ -0,0 +1,290 @@
+#include "reference_heatmap.h"
+
+// addHeatMap as it was before Heatmap::buildHeatMap, built from vectors of
+// coordinates, kept as the reference of the parity tests. The only change is
+// the bishop count of the right pawn, which read pawnHeight[j-1] (out of the
+// array on the first file).
+void ReferenceHeatmap::addHeatMap(CFBoard& board, int (&heatMap)[6][8][8], const uint64_t &weakPawns) {
+	using namespace Heatmap;
+
+	uint64_t maskRow[8], maskCol[8]; // 1 for one column or one row, 0 otherwise
+	maskRow[0] = (1LL<<8)-1;
+	maskCol[0] = 1LL + (1LL<<8) + (1LL<<16) + (1LL<<24) + (1LL<<32) + (1LL<<40) + (1LL<<48) + (1LL<<56);
+	for (int i = 1; i < 8; i++) {
+		maskRow[i] = maskRow[i-1]<<8;
+		maskCol[i] = maskCol[i-1]<<1;
+	}
+
+	bool currentTurn = board.getCurrentPlayer(); // 0: white, 1: black
+	uint64_t pawnBoard = board.getPieceColorBitBoard(0|currentTurn),
+	knightBoard = board.getPieceColorBitBoard(2|currentTurn),
+	bishopBoard = board.getPieceColorBitBoard(4|currentTurn),
+	rookBoard = board.getPieceColorBitBoard(6|currentTurn),
+	queenBoard = board.getPieceColorBitBoard(8|currentTurn),
+	kingBoard = board.getPieceColorBitBoard(10|currentTurn);
+	if (!currentTurn) { // switch orientation from white to black for easier code
+		pawnBoard = reverseBit(pawnBoard);
+		knightBoard = reverseBit(knightBoard);
+		bishopBoard = reverseBit(bishopBoard);
+		rookBoard = reverseBit(rookBoard);
+		queenBoard = reverseBit(queenBoard);
+		kingBoard = reverseBit(kingBoard);
+	}
+
+	// Counting pieces
+	int noKnights = __builtin_popcountll(knightBoard),
+		noRooks = __builtin_popcountll(rookBoard),
+		noQueens = __builtin_popcountll(queenBoard);
+
+	// Count how many light and dark squared bishop
+	int noBishopsColor[2] = {0, 0};
+	std::vector<int> bishop_tiles = bitSetPositions(bishopBoard);
+	for (int tile: bishop_tiles) {
+		int row = tile/8, col = tile%8;
+		noBishopsColor[(row+col)%2]++;
+	}
+
+	int pawnHeight[8] = {8, 8, 8, 8, 8, 8, 8, 8};
+	// displayPawnBoard(pawnBoard);
+	for (int i = 0; i < 8; i++) { 
+		uint64_t pawnRow = (pawnBoard & maskRow[i]) >> (8*i);
+		if (!pawnRow) continue;
+		for (int j = 0; j < 8; j++) {
+			if ((pawnRow >> j)&1 && pawnHeight[j] == 8) {
+				pawnHeight[j] = i;
+			}
+		}
+	}
+
+	// Calculating pawn heights of each column
+	std::vector<int> openFiles;
+	for (int j = 0; j < 8; j++) {
+		if (pawnHeight[j] == 8) {
+			openFiles.push_back(j);
+		}
+	}
+
+	// Number of free rows below the lowest pawn
+	int free_rows = (*std::min_element(pawnHeight, pawnHeight+8)); // number of rows below the lowest pawn
+	// std::cout << free_rows << '\n';
+	
+	uint64_t opponentPawnBoard = board.getPieceColorBitBoard(0|(!currentTurn));
+	if (!currentTurn) {
+		opponentPawnBoard = reverseBit(opponentPawnBoard);
+	}
+	if (openFiles.size() > 0) { // there exists open files
+		for (int j: openFiles) {
+			int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
+
+			// Rooks and Queens move to open file, priotizing staying on the lowest rank
+			for (int i = 0; i < maxPawnHeight; i++) {
+				if (squareNotAttackedByPawn(opponentPawnBoard, i, j)) // no opposing pawns
+					heatMap[3][i][j] += std::max(pawnHeight[j]+1 - i + noRooks, 0); // weighted since they are more important
+					heatMap[4][i][j] += std::max(pawnHeight[j]+1 - i + noQueens, 0); // weighted since they are more important
+			}
+
+			// Knights move to square near open file, defending the nearby pawns and pieces
+
+			// defend open file
+			for (int i = 0; i < maxPawnHeight; i++) {
+				addHeatMapPieceProtect(i, j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
+			}
+			// protect left pawn
+			if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
+				addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
+			}
+			// protect right pawn
+			if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
+				addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
+			}
+
+			// Bishops also move to square near open file, defending the nearby pawns and pieces
+
+			//defend open file
+			for (int i = 0; i < maxPawnHeight; i++) {
+				bool bishop_color = (i+j)%2;
+				addHeatMapPieceProtect(i, j, heatMap, 'B', noBishopsColor[bishop_color], opponentPawnBoard, pawnHeight);
+			}
+			// protect left pawn
+			if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
+				addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j-1]+j)%2],
+										opponentPawnBoard, pawnHeight);
+			}
+			// protect right pawn
+			if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
+				addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j+1]+j)%2],
+										opponentPawnBoard, pawnHeight);
+			}
+		}
+	} else { // No open files
+		// std::cout << free_rows << '\n';
+		std::vector<int> weakPawnFiles;
+		for (int i = 0; i < 8; i++) {
+			if (weakPawns & (1ll<<i)) { // ith bit is set
+				weakPawnFiles.push_back(i);
+			}
+		}
+		if (free_rows >= 2) { // 2 free rows, knights, rooks and queens are essentially able to go anywhere
+			// To be adjusted
+			for (int j: weakPawnFiles) {
+				int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
+
+				// Rooks move to behind the weak pawn, priotizing staying on the lowest rank
+				for (int i = 0; i < maxPawnHeight; i++) {
+					if (squareNotAttackedByPawn(opponentPawnBoard, i, j)) // no opposing pawns
+						heatMap[3][i][j] += std::max(pawnHeight[j]+1 - i + noRooks, 0);
+				}
+
+				int opponentPawnHeight = pawnHeight[j]+1;
+				// Queens attack weak pawns from the diagonals and the column
+				addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'Q', noQueens, opponentPawnBoard, pawnHeight);
+
+				// Knights move to square near weak pawn, attacking it
+				addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'N', noKnights, opponentPawnBoard, pawnHeight);
+
+				// Bishops attack weak pawns or defend current pawns, depends on the color of the bishop
+				// attacking
+				addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'B', noBishopsColor[(j+opponentPawnHeight)%2], opponentPawnBoard, pawnHeight);
+				// protect left pawn
+				if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
+					addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j-1]+j)%2],
+											opponentPawnBoard, pawnHeight);
+				}
+				// protect right pawn
+				if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
+					addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'B', noBishopsColor[(pawnHeight[j+1]+j)%2],
+											opponentPawnBoard, pawnHeight);
+				}
+
+				// King moves to near weak pawns, protect nearby pawns if opponent does not have many materials left on the board.
+				//														otherwise, stay as far as possible
+				int threshold = 15; // to be adjusted
+				int opponentMaterial = board.getMaterialCount(!currentTurn);
+				if (opponentMaterial < threshold) {
+					// protect left pawn
+					if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
+						addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
+					}
+					// protect right pawn
+					if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
+						addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
+					}
+				} else {
+					// stay in the left if weak pawn in the right
+					if (j >= 4) {
+						addHeatMapPieceProtect(0, 0, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
+					}
+					// stay in the right otherwise
+					else {
+						addHeatMapPieceProtect(0, 7, heatMap, 'K', 1, opponentPawnBoard, pawnHeight);
+					}
+				}
+			} 
+		} else {
+			// Define "area" the spaces that pieces are free to move, each area is separated by a pawn of height 1
+
+			// Pieces are more limited to their own "area", hence smaller coefficients added to
+			// squares outside of their "area" since it takes more turns to move them there.
+			
+			int numArea[8];
+			int cur = 0;
+			for (int i = 0; i < 8; i++) {
+				if (pawnHeight[i] == 1 && i != 0) {
+					numArea[i] = 2*cur+1;
+					cur++;
+				} else {
+					numArea[i] = 2*cur;
+				}
+			}
+			int countArea = numArea[7];
+			int distArea[8][8];
+			for (int j1 = 0; j1 < 8; j1++) {
+				for (int j2 = 0; j2 < 8; j2++) {
+					distArea[j1][j2] = countArea - abs(numArea[j1] - numArea[j2]); // gets smaller if two areas are far apart
+				}
+			}
+			
+			std::vector<std::vector<int>> knightPos = posSetFromBoard(knightBoard),
+										bishopPos = posSetFromBoard(bishopBoard), 
+										rookPos = posSetFromBoard(rookBoard), 
+										queenPos = posSetFromBoard(queenBoard), 
+										kingPos = posSetFromBoard(kingBoard);
+			// To be adjusted
+			for (int j: weakPawnFiles) {
+				int maxPawnHeight = std::min(j > 0 ? pawnHeight[j-1] : 8, j < 7 ? pawnHeight[j+1] : 8);
+
+				// Rooks move to behind the weak pawn, priotizing staying on the lowest rank
+				for (int i = 0; i < maxPawnHeight; i++) {
+					if (squareNotAttackedByPawn(opponentPawnBoard, i, j)) { // no opposing pawns 
+						for (std::vector<int> pos: rookPos)
+							heatMap[3][i][j] += std::max(pawnHeight[j]+1 - i + distArea[j][pos[1]], 0);
+					}
+				}
+
+				int opponentPawnHeight = pawnHeight[j]+1;
+				// Queens attack weak pawns from the diagonals and the column
+				for (std::vector<int> pos: queenPos)
+					addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'Q', 1, opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
+
+				// Knights move to square near weak pawn, attacking it
+				for (std::vector<int> pos: knightPos)
+					addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'N', 1, opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
+
+				// Bishops attack weak pawns or defend current pawns, depends on the color of the bishop
+				// attacking
+				for (std::vector<int> pos: bishopPos) {
+					bool bishopColor = (pos[0]+pos[1])%2;
+					if ((j+opponentPawnHeight)%2 == bishopColor)
+						addHeatMapPieceProtect(opponentPawnHeight, j, heatMap, 'B', 1,
+											opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
+					// protect left pawn
+					if (j >= 1 && validSquare(pawnHeight[j-1], j) && (pawnHeight[j-1]+j)%2 == bishopColor) {
+						addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'B', 1,
+												opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
+					}
+					// protect right pawn
+					if (j <= 6 && validSquare(pawnHeight[j+1], j) && (pawnHeight[j+1]+j)%2 == bishopColor) {
+						addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'B', 1,
+												opponentPawnBoard, pawnHeight, distArea[j][pos[1]]);
+					}
+				}
+
+				// King moves to near weak pawns, protect nearby pawns if opponent does not have many materials left on the board.
+				//														otherwise, stay as far as possible
+				int threshold = 15; // to be adjusted
+				int opponentMaterial = board.getMaterialCount(!currentTurn);
+				int kingCol = kingPos[0][1];
+				if (opponentMaterial < threshold) {
+					// protect left pawn
+					if (j >= 1 && validSquare(pawnHeight[j-1], j)) {
+						addHeatMapPieceProtect(pawnHeight[j-1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
+					}
+					// protect right pawn
+					if (j <= 6 && validSquare(pawnHeight[j+1], j)) {
+						addHeatMapPieceProtect(pawnHeight[j+1], j, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
+					}
+				} else {
+					// stay in the left if weak pawn in the right
+					if (j >= 4) {
+						addHeatMapPieceProtect(0, 0, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
+					}
+					// stay in the right otherwise
+					else {
+						addHeatMapPieceProtect(0, 7, heatMap, 'K', 1, opponentPawnBoard, pawnHeight, distArea[j][kingCol]);
+					}
+				}
+			} 
+		}
+	}
+	// Switch back to white's orientation if white's turn
+	if (!currentTurn) {
+		for (int halfPieceId = 0; halfPieceId < 6; halfPieceId++) {
+			for (int i = 0; i < 4; i++) {
+				for (int j = 0; j < 8; j++) {
+					std::swap(heatMap[halfPieceId][i][j], heatMap[halfPieceId][7-i][7-j]);
+				}
+			}
+		}
+	}
+}
+
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Heatmap.h>
+
+namespace ReferenceHeatmap {
+
+/**
+ * @brief The original implementation of Heatmap::addHeatMap, adding the
+ * heatmap of the board to heatMap.
+ */
+void addHeatMap(CFBoard &board, int (&heatMap)[6][8][8], const uint64_t &weakPawns);
+
+} // namespace ReferenceHeatmap
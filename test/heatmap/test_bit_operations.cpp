@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_bit_operations.h"
+#include <random>
+
+namespace {
+
+// Boards with a few, many, no and all bits set
+std::vector<uint64_t> testBoards() {
+	std::vector<uint64_t> boards = {0, ~0ull, 1, 1ull << 63, 0x00FF00000000FF00ull, 0x8040201008040201ull};
+	std::mt19937_64 random(201);
+	for (int i = 0; i < 1000; i++) {
+		uint64_t board = random();
+		boards.push_back(i % 2 ? board : board & random() & random());
+	}
+	return boards;
+}
+
+} // namespace
+
+TEST_CASE("reverseBit sends every tile to 63 - tile", "[heatmap]") {
+	for (uint64_t board : testBoards()) {
+		uint64_t expected = 0;
+		for (int tile = 0; tile < 64; tile++) {
+			if (isBitSet(board, tile)) expected |= 1ull << (63 - tile);
+		}
+		REQUIRE(reverseBit(board) == expected);
+		REQUIRE(reverseBit(reverseBit(board)) == board);
+	}
+}
+
+TEST_CASE("setBits visits the same tiles as bitSetPositions", "[heatmap]") {
+	for (uint64_t board : testBoards()) {
+		std::vector<int> visited;
+		for (int tile : setBits(board)) {
+			visited.push_back(tile);
+		}
+		REQUIRE(visited == bitSetPositions(board));
+	}
+}
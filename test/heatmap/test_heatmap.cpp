@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_heatmap.h"
+#include <cstring>
+
+namespace {
+
+// Weak pawn files given to the heatmaps: none, single files, both sides, all
+const uint64_t weakPawnMasks[] = {0x00, 0x01, 0x18, 0x80, 0xA5, 0xFF};
+
+void compareHeatMaps(CFBoard &board) {
+	for (uint64_t weakPawns : weakPawnMasks) {
+		int reference[6][8][8];
+		memset(reference, 0, sizeof reference);
+		ReferenceHeatmap::addHeatMap(board, reference, weakPawns);
+
+		int16_t flat[6][64];
+		Heatmap::buildHeatMap(board, flat, weakPawns);
+		int added[6][8][8];
+		memset(added, 0, sizeof added);
+		Heatmap::addHeatMap(board, added, weakPawns);
+
+		// First tile where a heatmap differs, one check per heatmap
+		int mismatch = -1;
+		for (int index = 0; index < 6 * 64 && mismatch == -1; index++) {
+			int halfPieceId = index / 64, tile = index % 64;
+			int expected = reference[halfPieceId][tile / 8][tile % 8];
+			if (flat[halfPieceId][tile] != expected || added[halfPieceId][tile / 8][tile % 8] != expected) {
+				mismatch = index;
+			}
+		}
+		INFO(board.toFEN() << ", weak pawns " << weakPawns << ", piece " << mismatch / 64 << " on " << mismatch % 64);
+		REQUIRE(mismatch == -1);
+	}
+}
+
+// The board turned by 180 degrees with the colors swapped, the other player
+// to move
+CFBoard mirrored(CFBoard &board) {
+	std::string FEN;
+	for (int row = 0; row < 8; row++) {
+		int empty = 0;
+		for (int col = 0; col < 8; col++) {
+			int pieceId = board.getPieceFromCoords(63 - (row * 8 + col));
+			if (pieceId == -1) {
+				empty++;
+				continue;
+			}
+			if (empty) FEN += std::to_string(empty);
+			empty = 0;
+			FEN += board.pieceIdToChar(pieceId ^ 1);
+		}
+		if (empty) FEN += std::to_string(empty);
+		if (row < 7) FEN += '/';
+	}
+	FEN += board.getCurrentPlayer() ? " w - - 0 1" : " b - - 0 1";
+	return CFBoard(FEN);
+}
+
+} // namespace
+
+TEST_CASE("Flat heatmaps match the original implementation on every corpus", "[heatmap]") {
+	for (const std::string &corpus : PositionsCorpus::fileNames) {
+		std::vector<std::string> FENs = PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + corpus);
+		REQUIRE(!FENs.empty());
+		for (const std::string &FEN : FENs) {
+			CFBoard board(FEN);
+			compareHeatMaps(board);
+			// Same pawns, seen from the other player
+			board.forceFlipTurn();
+			compareHeatMaps(board);
+		}
+	}
+}
+
+TEST_CASE("Flat heatmaps match the original implementation on open positions", "[heatmap]") {
+	std::vector<std::string> FENs = {
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"rnbqkbnr/8/5p1p/1p2pPpP/pP1pP1P1/P2P4/8/RNBQKBNR w KQkq - 0 1",
+		"rkqrbnnb/8/p5p1/Pp1p1pPp/1PpPpP1P/2P1P1N1/2B1QB1R/3K3R w - - 0 1",
+		"rkqr1nnb/4b3/8/p3p1p1/Pp1pPpPp/1PpP1P1P/R1P4N/1NKQBB1R w - - 0 1",
+		"rkq1bnnr/2b2p1p/4pPpP/3pP1P1/p1pP2N1/PpP5/1P4K1/RNBQ1B1R w - - 0 1",
+		"rkq1bnnr/2b4p/p5pP/Pp3pP1/1Pp1pP2/2PpP2N/3P4/1NBQRBKR b - - 0 1",
+		"4k3/8/8/8/8/8/8/4K3 w - - 0 1"};
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareHeatMaps(board);
+	}
+}
+
+TEST_CASE("Heatmaps of mirrored positions are mirrored", "[heatmap]") {
+	std::vector<std::string> FENs = PositionsCorpus::loadFENs(
+		std::string(POSITIONS_DIR) + "/completely_closed_positions.txt");
+	REQUIRE(!FENs.empty());
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		CFBoard other = mirrored(board);
+		for (uint64_t weakPawns : weakPawnMasks) {
+			// Both players see the board from their side: the weak pawn files are the same
+			int16_t heatMap[6][64], otherHeatMap[6][64];
+			Heatmap::buildHeatMap(board, heatMap, weakPawns);
+			Heatmap::buildHeatMap(other, otherHeatMap, weakPawns);
+			int mismatch = -1;
+			for (int index = 0; index < 6 * 64 && mismatch == -1; index++) {
+				if (heatMap[index / 64][index % 64] != otherHeatMap[index / 64][63 - index % 64]) {
+					mismatch = index;
+				}
+			}
+			INFO(FEN << ", weak pawns " << weakPawns << ", piece " << mismatch / 64 << " on " << mismatch % 64);
+			REQUIRE(mismatch == -1);
+		}
+	}
+}
@@ -0,0 +1,4 @@
+#pragma once
+#include "../../lib/heatmap/Heatmap.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include "reference_heatmap.h"
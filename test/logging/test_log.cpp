@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_log.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Log = Closedfish::Log;
+
+namespace {
+
+std::vector<std::string> readLines(const std::string &path) {
+	std::vector<std::string> lines;
+	std::ifstream file(path);
+	std::string line;
+	while (std::getline(file, line)) {
+		lines.push_back(line);
+	}
+	return lines;
+}
+
+// Text of a line without the time and thread prefix
+std::string message(const std::string &line) {
+	return line.substr(line.find(']') + 2);
+}
+
+std::string logPath() {
+	static int count = 0;
+	std::string name = "closedfish_log_test_" + std::to_string(count++) + ".txt";
+	std::string path = (std::filesystem::temp_directory_path() / name).string();
+	std::remove(path.c_str());
+	return path;
+}
+
+} // namespace
+
+TEST_CASE("Log writes the lines of the enabled levels", "[logging]") {
+	std::string path = logPath();
+	REQUIRE(Log::start(Log::Level::Info, path));
+	int evaluations = 0;
+	CF_LOG_DEBUG("debug ", ++evaluations);
+	CF_LOG_INFO("depth ", 12, " nodes ", uint64_t(123456789), " score ", 0.25);
+	CF_LOG_WARNING("promotion ", 'q', " ", true, " ", std::string("e7e8"));
+	Log::setLevel(Log::Level::Error);
+	CF_LOG_WARNING("warning ", ++evaluations);
+	CF_LOG_ERROR("error");
+	Log::stop();
+	CF_LOG_ERROR("stopped ", ++evaluations);
+
+	// Disabled calls do not evaluate their arguments
+	REQUIRE(evaluations == 0);
+	std::vector<std::string> lines = readLines(path);
+	REQUIRE(lines.size() == 3);
+	REQUIRE(message(lines[0]) == "INFO depth 12 nodes 123456789 score 0.25");
+	REQUIRE(message(lines[1]) == "WARNING promotion q true e7e8");
+	REQUIRE(message(lines[2]) == "ERROR error");
+	std::remove(path.c_str());
+}
+
+TEST_CASE("Log cuts long lines", "[logging]") {
+	std::string path = logPath();
+	REQUIRE(Log::start(Log::Level::Info, path));
+	CF_LOG_INFO(std::string(2 * Closedfish::LogRing::lineSize, 'x'));
+	Log::stop();
+	std::vector<std::string> lines = readLines(path);
+	REQUIRE(lines.size() == 1);
+	REQUIRE(lines[0].size() == Closedfish::LogRing::lineSize);
+	std::remove(path.c_str());
+}
+
+TEST_CASE("Log writes the lines of every thread", "[logging]") {
+	std::string path = logPath();
+	REQUIRE(Log::start(Log::Level::Info, path, 1));
+	const int threadCount = 4, linesPerThread = 100; // fits in the rings
+	std::vector<std::thread> threads;
+	for (int number = 0; number < threadCount; number++) {
+		threads.emplace_back([number] {
+			for (int i = 0; i < linesPerThread; i++) {
+				CF_LOG_INFO("thread ", number, " line ", i);
+			}
+		});
+	}
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+	Log::stop();
+	REQUIRE(Log::droppedLines() == 0);
+
+	// Each thread's lines come in the order it wrote them
+	std::vector<int> next(threadCount, 0);
+	for (const std::string &line : readLines(path)) {
+		int number, i;
+		REQUIRE(sscanf(message(line).c_str(), "INFO thread %d line %d", &number, &i) == 2);
+		REQUIRE(i == next[number]++);
+	}
+	for (int number = 0; number < threadCount; number++) {
+		REQUIRE(next[number] == linesPerThread);
+	}
+	std::remove(path.c_str());
+}
+
+TEST_CASE("Log does not start on a file it cannot open", "[logging]") {
+	REQUIRE(!Log::start(Log::Level::Info, "/nonexistent/directory/log.txt"));
+	REQUIRE(!Log::enabled(Log::Level::Error));
+}
@@ -0,0 +1,114 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_log_ring.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using Closedfish::LogRing;
+
+TEST_CASE("LogRing keeps the lines in order", "[logging]") {
+	LogRing ring(5);
+	REQUIRE(ring.capacity() == 8);
+	std::string line;
+	REQUIRE(!ring.pop(line));
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 8; i++) {
+			REQUIRE(ring.push("line " + std::to_string(i)));
+		}
+		REQUIRE(!ring.push("one too many"));
+		for (int i = 0; i < 8; i++) {
+			REQUIRE(ring.pop(line));
+			REQUIRE(line == "line " + std::to_string(i));
+		}
+		REQUIRE(!ring.pop(line));
+	}
+	REQUIRE(ring.droppedLines() == 3);
+}
+
+TEST_CASE("LogRing cuts long lines", "[logging]") {
+	LogRing ring(2);
+	std::string longLine(LogRing::lineSize + 10, 'x');
+	REQUIRE(ring.push(longLine));
+	std::string line;
+	REQUIRE(ring.pop(line));
+	REQUIRE(line == longLine.substr(0, LogRing::lineSize));
+}
+
+TEST_CASE("LogRing loses no line between threads", "[logging]") {
+	const int writers = 4, linesPerWriter = 20000;
+	LogRing ring(64);
+	std::atomic<uint64_t> failedPushes(0);
+	std::vector<std::thread> threads;
+	for (int writer = 0; writer < writers; writer++) {
+		threads.emplace_back([&ring, &failedPushes, writer] {
+			for (int i = 0; i < linesPerWriter; i++) {
+				std::string line = std::to_string(writer) + " " + std::to_string(i);
+				while (!ring.push(line)) {
+					failedPushes++;
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	// Lines of a writer come out in the order it wrote them
+	std::vector<int> next(writers, 0);
+	std::string line;
+	for (int received = 0; received < writers * linesPerWriter;) {
+		if (!ring.pop(line)) {
+			std::this_thread::yield();
+			continue;
+		}
+		size_t space = line.find(' ');
+		int writer = std::stoi(line.substr(0, space));
+		REQUIRE(std::stoi(line.substr(space + 1)) == next[writer]++);
+		received++;
+	}
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+	REQUIRE(!ring.pop(line));
+	REQUIRE(ring.droppedLines() == failedPushes);
+}
+
+TEST_CASE("Logger sends std::cout and its own stream to the ring", "[logging]") {
+	std::streambuf *original = std::cout.rdbuf();
+	std::string line;
+	{
+		Closedfish::Logger logger(Closedfish::LogOutput::RING, 4);
+		std::cout << "info depth " << 12 << std::endl;
+		logger.cout << "first\nsecond" << std::endl;
+		std::cout << "not flushed yet\n";
+		REQUIRE(logger.popLine(line));
+		REQUIRE(line == "info depth 12");
+		REQUIRE(logger.popLine(line));
+		REQUIRE(line == "first");
+		REQUIRE(logger.popLine(line));
+		REQUIRE(line == "second");
+		REQUIRE(!logger.popLine(line));
+
+		// A line longer than the buffer comes out in pieces
+		std::cout << std::string(LogRing::lineSize + 5, 'y') << std::endl;
+		REQUIRE(logger.popLine(line));
+		REQUIRE(line == "not flushed yet");
+		REQUIRE(logger.popLine(line));
+		REQUIRE(line == std::string(LogRing::lineSize, 'y'));
+		REQUIRE(logger.popLine(line));
+		REQUIRE(line == "yyyyy");
+	}
+	REQUIRE(std::cout.rdbuf() == original);
+}
+
+TEST_CASE("Logger without output formats nothing", "[logging]") {
+	std::streambuf *original = std::cout.rdbuf();
+	{
+		Closedfish::Logger logger(Closedfish::LogOutput::NONE);
+		REQUIRE(std::cout.bad());
+		REQUIRE(logger.cout.bad());
+		std::cout << "discarded" << std::endl;
+		logger.cout << 1.5 << std::endl;
+		std::string line;
+		REQUIRE(!logger.popLine(line));
+	}
+	REQUIRE(std::cout.rdbuf() == original);
+	REQUIRE(std::cout.good());
+}
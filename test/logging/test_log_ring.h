@@ -0,0 +1,3 @@
+#pragma once
+#include "../../lib/logging/LogRing.h"
+#include "../../lib/logging/logger.h"
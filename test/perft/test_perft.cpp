@@ -0,0 +1,121 @@
+#include "test_perft.h"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+struct ReferencePosition {
+	std::string FEN;
+	std::vector<uint64_t> nodes; // perft(1), perft(2), ...
+};
+
+// Published node counts (chessprogramming.org/Perft_Results)
+const std::vector<ReferencePosition> referencePositions = {
+		{"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		 {20, 400, 8902, 197281, 4865609, 119060324}},
+		{"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		 {48, 2039, 97862, 4085603, 193690690}},
+		{"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		 {14, 191, 2812, 43238, 674624, 11030083}},
+		{"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+		 {6, 264, 9467, 422333, 15833292}},
+		{"r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+		 {6, 264, 9467, 422333, 15833292}},
+		{"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+		 {44, 1486, 62379, 2103487, 89941194}},
+		{"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+		 {46, 2079, 89890, 3894594, 164075551}}};
+
+int threadCount() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+} // namespace
+
+TEST_CASE("Perft matches the reference node counts", "[perft]") {
+	for (const ReferencePosition &position : referencePositions) {
+		int maxDepth = std::min<int>(PERFT_TEST_DEPTH, position.nodes.size());
+		for (int depth = 1; depth <= maxDepth; depth++) {
+			Perft::Result result =
+					Perft::run(CFBoard(position.FEN), depth, threadCount());
+			INFO(position.FEN << " at depth " << depth);
+			if (result.nodes != position.nodes[depth - 1]) {
+				Perft::printDivide(result, std::cerr);
+			}
+			REQUIRE(result.nodes == position.nodes[depth - 1]);
+		}
+	}
+}
+
+TEST_CASE("getLegalMoves and movePiece match the reference node counts",
+					"[perft]") {
+	for (AttackTables::CheckMode mode : {AttackTables::CheckMode::CLASSIC,
+																			 AttackTables::CheckMode::ATTACK_MAP}) {
+		AttackTables::setCheckMode(mode);
+		for (const ReferencePosition &position : referencePositions) {
+			int maxDepth = std::min<int>(std::min(PERFT_TEST_DEPTH, 3),
+																	 position.nodes.size());
+			for (int depth = 1; depth <= maxDepth; depth++) {
+				Perft::Result result =
+						Perft::run(CFBoard(position.FEN), depth, threadCount(),
+											 Perft::MoveSource::GET_LEGAL_MOVES);
+				INFO(position.FEN << " at depth " << depth << " with the "
+													<< (mode == AttackTables::CheckMode::CLASSIC
+																	? "classic"
+																	: "attack-map")
+													<< " check detection");
+				if (result.nodes != position.nodes[depth - 1]) {
+					Perft::printDivide(result, std::cerr);
+				}
+				REQUIRE(result.nodes == position.nodes[depth - 1]);
+			}
+		}
+	}
+}
+
+TEST_CASE("Split-at-root perft agrees with the single-threaded count",
+					"[perft]") {
+	CFBoard board(referencePositions[1].FEN);
+	Perft::Result result = Perft::run(board, 3, 4);
+	REQUIRE(result.nodes == Perft::perft(board, 3));
+	REQUIRE(result.divide.size() == 48);
+
+	uint64_t sum = 0;
+	for (const Perft::DivideEntry &entry : result.divide) {
+		sum += entry.nodes;
+	}
+	REQUIRE(sum == result.nodes);
+	REQUIRE(board.toFEN() == CFBoard(referencePositions[1].FEN).toFEN());
+}
+
+TEST_CASE("Split-at-root perft of depth 0 counts the root position",
+					"[perft]") {
+	CFBoard board(referencePositions[1].FEN);
+	for (int depth : {0, -1}) {
+		Perft::Result result = Perft::run(board, depth, 4);
+		REQUIRE(result.nodes == Perft::perft(board, depth));
+		REQUIRE(result.nodes == 1);
+		REQUIRE(result.divide.empty());
+	}
+}
+
+TEST_CASE("Both move sources agree on every corpus position", "[perft][corpus]") {
+	uint64_t totalNodes = 0;
+	double totalSeconds = 0;
+	for (const std::string &fileName : PositionsCorpus::fileNames) {
+		std::vector<std::string> FENs =
+				PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + fileName);
+		REQUIRE(!FENs.empty());
+		for (const std::string &FEN : FENs) {
+			CFBoard board(FEN);
+			Perft::Result result = Perft::run(board, PERFT_CORPUS_DEPTH, 1);
+			INFO(FEN);
+			REQUIRE(result.nodes == Perft::perft(board, PERFT_CORPUS_DEPTH,
+																					 Perft::MoveSource::GET_LEGAL_MOVES));
+			totalNodes += result.nodes;
+			totalSeconds += result.seconds;
+		}
+	}
+	std::cout << "corpus perft(" << PERFT_CORPUS_DEPTH << "): " << totalNodes
+						<< " nodes, " << (uint64_t)(totalNodes / totalSeconds)
+						<< " nodes/second" << std::endl;
+}
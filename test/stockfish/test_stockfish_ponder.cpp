@@ -0,0 +1,96 @@
+#include "test_stockfish_ponder.h"
+
+namespace {
+
+// Session on the starting position with pondering set to ponder, after a
+// search whose principal variation gives our move and the expected answer
+StockfishResult searchFromStart(StockfishSession &session, CFBoard &board,
+																bool ponder) {
+	StockfishSession::Options options;
+	options.ponder = ponder;
+	session.setOptions(options);
+	session.setPosition(board);
+	Stockfish::Search::LimitsType limits;
+	limits.depth = 8;
+	StockfishResult result = session.search(limits);
+	REQUIRE(result.pv.size() >= 2);
+	return result;
+}
+
+void playMove(StockfishSession &session, CFBoard &board,
+							std::pair<int, int> move) {
+	REQUIRE(session.doMove(move.first, move.second));
+	board.movePiece(move.first, move.second);
+	REQUIRE(session.isAt(board));
+}
+
+} // namespace
+
+TEST_CASE("Pondering starts on our move only when it is on", "[stockfish]") {
+	initStockfish();
+	CFBoard board;
+	StockfishSession session;
+	StockfishResult result = searchFromStart(session, board, false);
+	playMove(session, board, result.pv[0]);
+	REQUIRE(!session.isPondering());
+
+	CFBoard other;
+	result = searchFromStart(session, other, true);
+	playMove(session, other, result.pv[0]);
+	REQUIRE(session.isPondering());
+	session.stopPondering();
+	REQUIRE(!session.isPondering());
+}
+
+TEST_CASE("A ponder hit goes on with the search started on the opponent's time",
+					"[stockfish]") {
+	initStockfish();
+	CFBoard board;
+	StockfishSession session;
+	StockfishResult result = searchFromStart(session, board, true);
+	playMove(session, board, result.pv[0]);
+	REQUIRE(session.isPondering());
+
+	// The answer the search expected
+	playMove(session, board, result.pv[1]);
+	REQUIRE(session.isPondering());
+
+	Stockfish::Search::LimitsType limits;
+	limits.depth = 8;
+	result = session.search(limits);
+	REQUIRE(!session.isPondering());
+	REQUIRE(result.depth == 8);
+	REQUIRE(isLegal(board, std::get<0>(result.move), std::get<1>(result.move)));
+}
+
+TEST_CASE("A ponder miss searches the position actually played",
+					"[stockfish]") {
+	initStockfish();
+	CFBoard board;
+	StockfishSession session;
+	StockfishResult result = searchFromStart(session, board, true);
+	playMove(session, board, result.pv[0]);
+	REQUIRE(session.isPondering());
+
+	// Any other answer stops the ponder search
+	MoveList moveList;
+	board.generateMoves(moveList);
+	std::pair<int, int> answer = result.pv[1];
+	for (int i = 0; i < moveList.size(); i++) {
+		std::pair<int, int> move(CFMove::startTile(moveList[i]),
+														 CFMove::endTile(moveList[i]));
+		if (move != result.pv[1]) {
+			answer = move;
+			break;
+		}
+	}
+	REQUIRE(answer != result.pv[1]);
+	playMove(session, board, answer);
+	REQUIRE(!session.isPondering());
+
+	Stockfish::Search::LimitsType limits;
+	limits.depth = 8;
+	result = session.search(limits);
+	REQUIRE(result.depth == 8);
+	REQUIRE(isLegal(board, std::get<0>(result.move), std::get<1>(result.move)));
+}
@@ -0,0 +1,2 @@
+#pragma once
+#include "test_stockfish_search.h"
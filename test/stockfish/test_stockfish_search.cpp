@@ -0,0 +1,116 @@
+#include "test_stockfish_search.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+void initStockfish() {
+	static bool initialized = false;
+	if (initialized) {
+		return;
+	}
+	initialized = true;
+	char name[] = "stockfish_tests";
+	char *argv[] = {name, nullptr};
+	Stockfish::CommandLine::init(1, argv);
+	Stockfish::UCI::init(Stockfish::Options);
+	Stockfish::Options["EvalFile"] = std::string(STOCKFISH_SRC_DIR) + "/" +
+																	 (std::string)Stockfish::Options["EvalFile"];
+	Stockfish::Tune::init();
+	Stockfish::PSQT::init();
+	Stockfish::Bitboards::init();
+	Stockfish::Position::init();
+	Stockfish::Bitbases::init();
+	Stockfish::Endgames::init();
+	Stockfish::Threads.set(1);
+	Stockfish::Search::clear(); // After threads are up
+	Stockfish::Eval::NNUE::init();
+}
+
+bool isLegal(CFBoard &board, int startTile, int endTile) {
+	MoveList moveList;
+	board.generateMoves(moveList);
+	for (int i = 0; i < moveList.size(); i++) {
+		if (CFMove::startTile(moveList[i]) == startTile &&
+				CFMove::endTile(moveList[i]) == endTile) {
+			return true;
+		}
+	}
+	return false;
+}
+
+TEST_CASE("A depth-limited search stops at that depth", "[stockfish]") {
+	initStockfish();
+	CFBoard board;
+	StockfishSession session;
+	session.setPosition(board);
+	for (int depth : {1, 4, 8}) {
+		Stockfish::Search::LimitsType limits;
+		limits.depth = depth;
+		StockfishResult result = session.search(limits);
+		INFO("depth " << depth);
+		REQUIRE(result.depth == depth);
+		REQUIRE(result.nodes > 0);
+		REQUIRE(isLegal(board, std::get<0>(result.move), std::get<1>(result.move)));
+		REQUIRE(!result.pv.empty());
+		REQUIRE(result.pv[0] == std::make_pair(std::get<0>(result.move),
+																					 std::get<1>(result.move)));
+	}
+
+	// The same through call_stockfish, on a position of its own
+	Stockfish::Position pos;
+	Stockfish::StateListPtr states;
+	convert_CFBoard_to_Stockfish_Position(board, pos, states);
+	Stockfish::Search::LimitsType limits;
+	limits.depth = 5;
+	StockfishResult result = call_stockfish(pos, states, limits);
+	REQUIRE(result.depth == 5);
+	REQUIRE(isLegal(board, std::get<0>(result.move), std::get<1>(result.move)));
+}
+
+TEST_CASE("StockfishEngine answers with a legal move within its limits",
+					"[stockfish]") {
+	initStockfish();
+	CFBoard board(
+			"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+	StockfishEngine engine;
+	engine.setBoardPointer(&board);
+	Closedfish::SearchLimits limits;
+	limits.maxNodes = 20000;
+	engine.setSearchLimits(limits);
+	for (int ply = 0; ply < 4; ply++) {
+		Closedfish::Move move = engine.getNextMove();
+		REQUIRE(isLegal(board, std::get<0>(move), std::get<1>(move)));
+		engine.processMove(move);
+	}
+}
+
+TEST_CASE("A stopped search returns early with a move", "[stockfish]") {
+	initStockfish();
+	CFBoard board;
+	StockfishSession session;
+	session.setPosition(board);
+	Stockfish::Search::LimitsType limits;
+	limits.depth = 60;
+
+	// Stopped before the search starts: seen through the stop flag
+	std::atomic<bool> stop{true};
+	session.setStopFlag(&stop);
+	auto start = std::chrono::steady_clock::now();
+	StockfishResult result = session.search(limits);
+	REQUIRE(result.depth < 60);
+	REQUIRE(isLegal(board, std::get<0>(result.move), std::get<1>(result.move)));
+
+	// Stopped from another thread during the search
+	stop = false;
+	std::thread stopper([&stop] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		stop = true;
+		StockfishSession::stopSearch();
+	});
+	result = session.search(limits);
+	stopper.join();
+	REQUIRE(result.depth < 60);
+	REQUIRE(isLegal(board, std::get<0>(result.move), std::get<1>(result.move)));
+	REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+	session.setStopFlag(nullptr);
+}
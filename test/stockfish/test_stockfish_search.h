@@ -0,0 +1,19 @@
+#pragma once
+#include "../../lib/board_implementation/CFBoard.h"
+#include "../../lib/board_implementation/MoveList.h"
+#include "../../src/connectors/StockfishConnect/StockfishConnect.h"
+#include <catch2/catch_test_macros.hpp>
+#include <stockfish/src/evaluate.h>
+#include <stockfish/src/misc.h>
+#include <stockfish/src/tune.h>
+
+/**
+ * @brief Sets Stockfish up once, like SwitchMain does: tables, one thread and
+ * the network of external/stockfish/src.
+ */
+void initStockfish();
+
+/**
+ * @brief Whether the move from startTile to endTile is legal on board.
+ */
+bool isLegal(CFBoard &board, int startTile, int endTile);
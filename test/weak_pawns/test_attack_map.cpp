@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_attack_map.h"
+
+namespace {
+
+// Every query of the map against attackersTo and attackedTiles
+void compareWithAttackers(CFBoard &board) {
+	PositionView position(board);
+	AttackMap map(position);
+	uint64_t occupancy = position.occupancy();
+	INFO(board.toFEN());
+	for (bool color : {false, true}) {
+		REQUIRE(map.attackedBy(color) == position.attackedTiles(color, occupancy));
+		REQUIRE(map.dangerousTiles(color) == position.attackedTiles(!color, occupancy));
+		for (int tile = 0; tile < 64; tile++) {
+			uint64_t attackers = position.attackersTo(tile, occupancy) & position.colorPieces(color);
+			REQUIRE(map.attackerCount(color, tile) == __builtin_popcountll(attackers));
+			int leastValuable = -1;
+			for (int attackerTile : setBits(attackers)) {
+				int pieceId = position.pieceAt(attackerTile);
+				if (leastValuable == -1 || pieceId < leastValuable) leastValuable = pieceId;
+			}
+			REQUIRE(map.leastValuableAttacker(color, tile) == leastValuable);
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("AttackMap matches attackersTo", "[weak_pawns]") {
+	std::vector<std::string> FENs = {
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+	};
+	for (const std::string &corpus : PositionsCorpus::fileNames) {
+		std::vector<std::string> corpusFENs = PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + corpus);
+		REQUIRE(!corpusFENs.empty());
+		for (int i = 0; i < (int)corpusFENs.size(); i += 25) {
+			FENs.push_back(corpusFENs[i]);
+		}
+	}
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareWithAttackers(board);
+		MoveList moveList;
+		board.generateMoves(moveList);
+		for (uint16_t move : moveList) {
+			board.makeMove(move);
+			compareWithAttackers(board);
+			board.undoLastMove();
+		}
+	}
+}
+
+TEST_CASE("AttackMap::get caches the map of a position", "[weak_pawns]") {
+	AttackMap::clearCache();
+	CFBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+	PositionView position(board);
+	AttackMap built(position);
+
+	AttackMap first = AttackMap::get(position);
+	REQUIRE(AttackMap::getCacheStats().misses == 1);
+	AttackMap second = AttackMap::get(position);
+	REQUIRE(AttackMap::getCacheStats().hits == 1);
+	// A hit is the cached map itself, not a copy
+	REQUIRE(&AttackMap::get(position) == &AttackMap::get(position));
+	for (bool color : {false, true}) {
+		REQUIRE(first.attackedBy(color) == built.attackedBy(color));
+		REQUIRE(second.attackedBy(color) == built.attackedBy(color));
+	}
+
+	// Another position is not taken from the cache, and without keeps the key
+	// in step with the pieces
+	PositionView withoutQueen = position.without(45);
+	REQUIRE(withoutQueen.getHash() != position.getHash());
+	AttackMap third = AttackMap::get(withoutQueen);
+	REQUIRE(AttackMap::getCacheStats().misses == 2);
+	REQUIRE(third.attackedBy(0) == AttackMap(withoutQueen).attackedBy(0));
+	REQUIRE(third.attackedBy(0) != first.attackedBy(0));
+
+	AttackMap::clearCache();
+	REQUIRE(AttackMap::getCacheStats().hits == 0);
+	REQUIRE(AttackMap::getCacheStats().misses == 0);
+}
+
+TEST_CASE("canPieceMoveOut looks at the tiles the piece moves to", "[weak_pawns]") {
+	// The rook on e4 is attacked by the rook on e8: it can only go along the
+	// e-file, where e5 to e7 and e3, e2 stay attacked once it left
+	CFBoard board("4r1k1/8/8/8/2p1R1p1/8/8/K7 w - - 0 1");
+	REQUIRE(canPieceMoveOut(board, 36) == 2); // d4 is safe
+	CFBoard trapped("4rk2/8/8/3p1p2/2pPRP2/4P3/8/K7 w - - 0 1");
+	REQUIRE(canPieceMoveOut(trapped, 36) == 1); // only e5 to e8, all attacked
+	CFBoard blocked("k7/8/8/4P3/3PRP2/4P3/8/K7 w - - 0 1");
+	REQUIRE(canPieceMoveOut(blocked, 36) == 0);
+}
+
+TEST_CASE("getPieceMovements returns the three boards by value", "[weak_pawns]") {
+	// The knight on d2 protects the bishop on b3, the rook on e4 and the pawn
+	// on f3, which can all move out of its way to a safe tile
+	CFBoard board("k7/8/8/8/4R3/1B3P2/3N4/K7 w - - 0 1");
+	PieceMovements movements = getPieceMovements(board, 51);
+	REQUIRE(movements.direct == PositionView(board).legalMoves(51));
+	REQUIRE(movements.afterMoveOut == ((1ull << 41) | (1ull << 36) | (1ull << 45)));
+	REQUIRE(movements.losses == 0);
+}
@@ -0,0 +1,5 @@
+#pragma once
+#include "../../lib/weak_pawns/AttackMap.h"
+#include "../../lib/weak_pawns/PieceMovements.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include "../../lib/heatmap/BitOperations.h"
@@ -0,0 +1,219 @@
+#include <catch2/catch_test_macros.hpp>
+#include "test_pawn_structure.h"
+#include <random>
+
+namespace {
+
+bool hasPawn(uint64_t pawns, int row, int col) {
+	return row >= 0 && row < 8 && col >= 0 && col < 8 && ((pawns >> (row * 8 + col)) & 1);
+}
+
+// Whether pawns has a pawn on the columns fromCol to toCol, in front of row
+// if inFront, else on or behind it, for pawns moving in direction dir
+bool pawnBetween(uint64_t pawns, int row, int dir, bool inFront, int fromCol, int toCol) {
+	for (int r = 0; r < 8; r++) {
+		if (inFront ? (r - row) * dir <= 0 : (r - row) * dir > 0) continue;
+		for (int c = fromCol; c <= toCol; c++) {
+			if (hasPawn(pawns, r, c)) return true;
+		}
+	}
+	return false;
+}
+
+// The masks of analyze, checked pawn by pawn and tile by tile
+PawnStructure::Side naiveSide(uint64_t pawns, uint64_t opponent, bool color) {
+	PawnStructure::Side side = {};
+	side.pawns = pawns;
+	int dir = color ? 1 : -1;
+	int opponentDir = -dir;
+	for (int tile = 0; tile < 64; tile++) {
+		int row = tile / 8, col = tile % 8;
+		uint64_t bit = 1ull << tile;
+		int attackers = hasPawn(pawns, row - dir, col - 1) + hasPawn(pawns, row - dir, col + 1);
+		if (attackers >= 1) side.attacks |= bit;
+		if (attackers == 2) side.doubleAttacks |= bit;
+		for (int r = 0; r < 8; r++) {
+			if ((row - r) * dir > 0 && hasPawn(pawns, r, col)) side.frontSpan |= bit;
+			if ((row - r) * dir > 0 && (hasPawn(pawns, r, col - 1) || hasPawn(pawns, r, col + 1))) side.attackSpan |= bit;
+		}
+		if (!(pawns & bit)) continue;
+
+		if (attackers) side.protectedPawns |= bit;
+		if (attackers || hasPawn(pawns, row, col - 1) || hasPawn(pawns, row, col + 1)) side.connected |= bit;
+		int neighbors = 0, sameFile = 0;
+		for (int r = 0; r < 8; r++) {
+			neighbors += hasPawn(pawns, r, col - 1) + hasPawn(pawns, r, col + 1);
+			sameFile += hasPawn(pawns, r, col);
+		}
+		if (!neighbors) side.isolated |= bit;
+		if (sameFile > 1) side.doubled |= bit;
+		if (!pawnBetween(opponent, row, dir, true, col - 1, col + 1)) side.passed |= bit;
+		int stop = row + dir;
+		if (stop >= 0 && stop < 8 &&
+				(hasPawn(opponent, stop - opponentDir, col - 1) || hasPawn(opponent, stop - opponentDir, col + 1)) &&
+				!pawnBetween(pawns, row, dir, false, col - 1, col - 1) &&
+				!pawnBetween(pawns, row, dir, false, col + 1, col + 1)) {
+			side.backward |= bit;
+		}
+	}
+	return side;
+}
+
+void compareStructures(uint64_t whitePawns, uint64_t blackPawns) {
+	PawnStructure::Structure structure = PawnStructure::analyze(whitePawns, blackPawns);
+	for (bool color : {false, true}) {
+		PawnStructure::Side expected = naiveSide(color ? blackPawns : whitePawns, color ? whitePawns : blackPawns, color);
+		const PawnStructure::Side &side = structure.sides[color];
+		INFO("white pawns " << whitePawns << ", black pawns " << blackPawns << ", color " << color);
+		REQUIRE(side.pawns == expected.pawns);
+		REQUIRE(side.attacks == expected.attacks);
+		REQUIRE(side.doubleAttacks == expected.doubleAttacks);
+		REQUIRE(side.frontSpan == expected.frontSpan);
+		REQUIRE(side.attackSpan == expected.attackSpan);
+		REQUIRE(side.protectedPawns == expected.protectedPawns);
+		REQUIRE(side.connected == expected.connected);
+		REQUIRE(side.isolated == expected.isolated);
+		REQUIRE(side.doubled == expected.doubled);
+		REQUIRE(side.passed == expected.passed);
+		REQUIRE(side.backward == expected.backward);
+	}
+}
+
+// The protector count before PositionView: every ally piece that can legally
+// move onto the tile once the piece on it is removed. Castling onto the tile
+// of a removed knight or bishop is not taking back
+int referenceProtectingPieces(CFBoard board, int tile) {
+	int pieceId = board.getPieceFromCoords(tile);
+	bool color = pieceId % 2;
+	int count = 0;
+	for (int pawnTile : bitSetPositions(board.getPieceColorBitBoard(color))) {
+		count += (AttackTables::pawnAttacks[color][pawnTile] >> tile) & 1;
+	}
+	board.forceRemovePiece(tile);
+	for (int halfPieceId = 1; halfPieceId < 6; halfPieceId++) {
+		for (int allyTile : bitSetPositions(board.getPieceColorBitBoard(2 * halfPieceId + color))) {
+			uint64_t moves = board.getLegalMoves(2 * halfPieceId + color, allyTile);
+			if (halfPieceId == 5) {
+				moves &= AttackTables::kingAttacks[allyTile];
+			}
+			count += (moves >> tile) & 1;
+		}
+	}
+	return count;
+}
+
+// The weak pawn selection DFS1P used before weakestPawnFiles
+uint64_t referenceWeakestPawnFiles(CFBoard &board, bool color) {
+	uint64_t weakFiles = 0;
+	int fewestProtectors = 1e9;
+	for (int tile : bitSetPositions(board.getPieceColorBitBoard(color))) {
+		int count = referenceProtectingPieces(board, tile);
+		if (count < fewestProtectors) {
+			fewestProtectors = count;
+			weakFiles = 0;
+		}
+		if (count == fewestProtectors) {
+			weakFiles |= 1ull << (tile % 8);
+		}
+	}
+	return weakFiles;
+}
+
+void compareWeakPawns(CFBoard &board) {
+	for (bool color : {false, true}) {
+		INFO(board.toFEN() << ", color " << color);
+		REQUIRE(WeakPawns::weakestPawnFiles(board, color) == referenceWeakestPawnFiles(board, color));
+	}
+	for (int tile = 0; tile < 64; tile++) {
+		if (board.getPieceFromCoords(tile) != -1) {
+			INFO(board.toFEN() << ", piece on " << tile);
+			REQUIRE(WeakPawns::nbProtectingPieces(board, tile) == referenceProtectingPieces(board, tile));
+		}
+	}
+}
+
+} // namespace
+
+TEST_CASE("Pawn structure masks match pawn by pawn checks", "[weak_pawns]") {
+	for (const std::string &corpus : PositionsCorpus::fileNames) {
+		std::vector<std::string> FENs = PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + corpus);
+		REQUIRE(!FENs.empty());
+		for (const std::string &FEN : FENs) {
+			CFBoard board(FEN);
+			compareStructures(board.getPieceColorBitBoard(0), board.getPieceColorBitBoard(1));
+		}
+	}
+
+	// Random pawns anywhere between the second and the seventh row
+	std::mt19937_64 rng(201);
+	for (int i = 0; i < 2000; i++) {
+		uint64_t rows = 0x00FFFFFFFFFFFF00ull;
+		uint64_t whitePawns = rng() & rng() & rows;
+		uint64_t blackPawns = rng() & rng() & rows & ~whitePawns;
+		compareStructures(whitePawns, blackPawns);
+	}
+}
+
+TEST_CASE("Pawn structure of a known position", "[weak_pawns]") {
+	// White: a2, c3, c4, e4, f5, h2; black: a7, b6, d5, e5, g6
+	CFBoard board("4k3/p7/1p4p1/3ppP2/2P1P3/2P5/P6P/4K3 w - - 0 1");
+	PawnStructure::Structure structure = PawnStructure::analyze(board);
+	const PawnStructure::Side &white = structure.sides[0], &black = structure.sides[1];
+	auto tiles = [](std::initializer_list<int> list) {
+		uint64_t board = 0;
+		for (int tile : list) board |= 1ull << tile;
+		return board;
+	};
+	// a2 = 48, c3 = 42, c4 = 34, e4 = 36, f5 = 29, h2 = 55
+	REQUIRE(white.doubled == tiles({42, 34}));
+	REQUIRE(white.isolated == tiles({48, 42, 34, 55}));
+	REQUIRE(white.protectedPawns == tiles({29}));
+	REQUIRE(white.connected == tiles({29}));
+	REQUIRE(white.passed == tiles({}));
+	// The stop tiles c4 and c5 are attacked by d5 and b6, with no white pawn
+	// on the b and d files
+	REQUIRE(white.backward == tiles({42, 34}));
+	// a7 = 8, b6 = 17, d5 = 27, e5 = 28, g6 = 22
+	REQUIRE(black.protectedPawns == tiles({17}));
+	REQUIRE(black.connected == tiles({17, 27, 28}));
+	REQUIRE(black.isolated == tiles({22}));
+	REQUIRE(black.passed == tiles({}));
+	REQUIRE(black.backward == tiles({}));
+}
+
+TEST_CASE("Protector counts match the legal moves onto the tile", "[weak_pawns]") {
+	// Protectors pinned along or across the line, in check, a king that
+	// cannot take back
+	std::vector<std::string> FENs = {
+		"4k3/8/8/1b6/8/3N4/4P3/4K3 w - - 0 1",
+		"4k3/8/8/8/8/4R3/4P3/4KR1r w - - 0 1",
+		"4k3/4r3/8/8/8/8/3PB3/4K3 w - - 0 1",
+		"4k3/8/8/8/1b6/8/3P4/4K3 w - - 0 1",
+		"4k3/8/8/8/8/8/3Pn3/4K3 w - - 0 1",
+		"4k3/8/8/8/8/5n2/3P4/4K3 w - - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1",
+	};
+	for (const std::string &FEN : FENs) {
+		CFBoard board(FEN);
+		compareWeakPawns(board);
+	}
+
+	for (const std::string &corpus : PositionsCorpus::fileNames) {
+		std::vector<std::string> corpusFENs = PositionsCorpus::loadFENs(std::string(POSITIONS_DIR) + "/" + corpus);
+		REQUIRE(!corpusFENs.empty());
+		for (int i = 0; i < (int)corpusFENs.size(); i++) {
+			CFBoard board(corpusFENs[i]);
+			compareWeakPawns(board);
+			if (i % 50 != 0) continue;
+			// Children, to move the pieces in front of the pawns
+			MoveList moveList;
+			board.generateMoves(moveList);
+			for (uint16_t move : moveList) {
+				CFBoard child(corpusFENs[i]);
+				child.makeMove(move);
+				compareWeakPawns(child);
+			}
+		}
+	}
+}
@@ -0,0 +1,6 @@
+#pragma once
+#include "../../lib/weak_pawns/PawnStructure.h"
+#include "../../lib/weak_pawns/WeakPawns.h"
+#include "../../lib/board_implementation/PositionsCorpus.h"
+#include "../../lib/heatmap/BitOperations.h"
+#include "../../lib/board_implementation/AttackTables.h"